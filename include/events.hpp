@@ -14,6 +14,9 @@
 
 #include "Vec2.hpp"
 
+/// Gamepads sampled each frame, the players beyond them are bots.
+#define EVENT_CONTROLLERS 4
+
 namespace indie
 {
     /// Contains an event's data.
@@ -129,14 +132,16 @@ namespace indie
         };
 
         // Member data
-        union {
-            /// Is the window resized?
-            bool resized;
-            /// Key event parameters (Event::KeyPressed, Event::KeyReleased).
-            KeyEvent key;
-            /// Controller events
-            ControllerEvent controller[4];
-        };
+        //
+        // These used to share a union, so every controller 0 update overwrote the keyboard state and the other way
+        // around. They are all valid at the same time now.
+
+        /// Is the window resized?
+        bool resized;
+        /// Key event parameters (Event::KeyPressed, Event::KeyReleased).
+        KeyEvent key;
+        /// Controller events
+        ControllerEvent controller[EVENT_CONTROLLERS];
     };
 } // namespace indie
 
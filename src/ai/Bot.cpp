@@ -0,0 +1,129 @@
+/**
+ * @file Bot.cpp
+ * @brief Computer controlled player source file
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "Bot.hpp"
+#include <algorithm>
+#include <cmath>
+
+indie::ai::Bot::Bot(int player) : _player(player), _plannedFrom(-1), _plannedStep(-1), _plannedFleeing(false)
+{
+}
+
+indie::ai::Bot::~Bot()
+{
+}
+
+int indie::ai::Bot::route(
+    const indie::board::Plane &passable, int from, const indie::board::Plane &goals, int &distance)
+{
+    indie::board::Plane seen;
+
+    distance = 0;
+    if (goals.test(from))
+        return (from);
+    seen.set(from);
+    this->_layers.clear();
+    this->_layers.push_back(seen);
+    while (true) {
+        indie::board::Plane next = (this->_layers.back().adjacent() & passable).without(seen);
+        if (!next.any())
+            return (-1);
+        seen |= next;
+        this->_layers.push_back(next);
+        int tile = (next & goals).first();
+        if (tile < 0)
+            continue;
+        // Walk back through the wavefronts to the tile next to the start
+        distance = static_cast<int>(this->_layers.size()) - 1;
+        for (size_t layer = this->_layers.size() - 2; layer > 0; layer--) {
+            indie::board::Plane current;
+            current.set(tile);
+            tile = (current.adjacent() & this->_layers[layer]).first();
+        }
+        return (tile);
+    }
+}
+
+indie::Event::JoystickDirection indie::ai::Bot::steer(const Situation &self, int tile) const
+{
+    float dx = indie::board::Board::getTileX(tile) - self.x;
+    float dy = indie::board::Board::getTileY(tile) - self.y;
+    // Half a movement step, closer than that another step would only overshoot
+    float tolerance = static_cast<float>(self.speed) / 100.0f;
+    indie::Event::JoystickDirection horizontal = dx > 0 ? indie::Event::RIGHT : indie::Event::LEFT;
+    indie::Event::JoystickDirection vertical = dy > 0 ? indie::Event::DOWN : indie::Event::UP;
+
+    if (std::abs(dx) <= tolerance && std::abs(dy) <= tolerance)
+        return (indie::Event::JOYSTICK_NONE);
+    if (std::abs(dx) >= std::abs(dy))
+        return (std::abs(dy) > tolerance ? vertical : horizontal);
+    return (std::abs(dx) > tolerance ? horizontal : vertical);
+}
+
+indie::ai::Bot::Decision indie::ai::Bot::decide(
+    const indie::board::Board &board, const indie::board::DangerMap &danger, const Situation &self, bool replan)
+{
+    Decision decision = {indie::Event::JOYSTICK_NONE, false};
+    int tile = board.getPlayerTile(this->_player);
+    int distance = 0;
+    int step = -1;
+
+    if (tile < 0 || self.speed == 0) {
+        this->_plannedFrom = -1;
+        return (decision);
+    }
+    indie::board::Plane walkable = board.getFree().without(board.getFlames());
+    indie::board::Plane unsafe = danger.getDanger() | board.getFlames();
+    // Danger reaching the player, or a flame or a bomb on the planned step, cannot wait for the next plan
+    if (!replan && tile == this->_plannedFrom && unsafe.test(tile) == this->_plannedFleeing
+        && (this->_plannedStep < 0 || this->_plannedStep == tile || walkable.test(this->_plannedStep))) {
+        if (this->_plannedStep >= 0)
+            decision.direction = steer(self, this->_plannedStep);
+        return (decision);
+    }
+    indie::board::Plane safe = walkable.without(unsafe);
+    if (unsafe.test(tile)) {
+        step = route(walkable, tile, safe, distance);
+    } else {
+        indie::board::Plane here;
+        here.set(tile);
+        // Whatever the number of players, the opponents are one plane: every occupied tile but this one
+        indie::board::Plane opponents = board.getPlayers().without(here);
+        // Tiles from which a bomb reaches a box or an opponent
+        indie::board::Plane targets = (board.getBoxes().adjacent() | board.getBlast(opponents, self.reach)) & safe;
+        if (targets.test(tile) && self.canBomb && !board.getBombs().test(tile)) {
+            int escape = route(walkable, tile, walkable.without(unsafe | board.getBlast(here, self.reach)), distance);
+            std::uint64_t ticksPerTile = 100 / self.speed + 1;
+            std::uint64_t fuse = self.fuseTicks;
+            // A blast crossing the escape route before the fuse ends would chain the bomb and catch the bot
+            if (escape >= 0 && danger.getEarliest(escape) != indie::board::DangerMap::SAFE)
+                fuse = std::min(fuse, danger.getEarliest(escape) - std::min(self.now, danger.getEarliest(escape)));
+            if (escape >= 0 && static_cast<std::uint64_t>(distance + 1) * ticksPerTile < fuse) {
+                decision.bomb = true;
+                step = escape;
+            }
+        }
+        if (!decision.bomb)
+            step = route(safe, tile, targets, distance);
+    }
+    this->_plannedFrom = tile;
+    this->_plannedStep = step;
+    this->_plannedFleeing = unsafe.test(tile);
+    if (step >= 0)
+        decision.direction = steer(self, step);
+    return (decision);
+}
+
+void indie::ai::Bot::forget()
+{
+    this->_plannedFrom = -1;
+    this->_plannedStep = -1;
+    this->_plannedFleeing = false;
+}
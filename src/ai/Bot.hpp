@@ -0,0 +1,136 @@
+/**
+ * @file Bot.hpp
+ * @brief Computer controlled player header file
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef BOT_HPP_
+#define BOT_HPP_
+
+#include <cstdint>
+#include <vector>
+#include "../board/Board.hpp"
+#include "../board/DangerMap.hpp"
+#include "events.hpp"
+
+namespace indie::ai
+{
+    /**
+     * @brief Plays a player on the tile grid, through the same stick and button as a human
+     *
+     * Every decision is a few breadth-first searches over the bitboard planes: fleeing the danger when standing in
+     * it, otherwise walking to the closest safe tile from which a bomb would hit a box or an opponent, and dropping it
+     * there when an escape route is short enough for the fuse, or for the earlier blast that would chain it.
+     *
+     * The searches only run when asked to re-plan, when the player entered another tile, when the danger reached or
+     * left it or when the planned step got blocked; in between the bot keeps steering toward the step it planned.
+     */
+    class Bot {
+      public:
+        /// @brief State of the player the bot drives
+        struct Situation {
+            /// @brief World x of the player
+            float x;
+            /// @brief World y of the player
+            float y;
+            /// @brief Reach of its bombs, in tiles
+            int reach;
+            /// @brief Can it drop a bomb
+            bool canBomb;
+            /// @brief Speed of the player
+            unsigned int speed;
+            /// @brief Fuse of its bombs, in ticks
+            std::uint32_t fuseTicks;
+            /// @brief Current tick of the fuse clock
+            std::uint64_t now;
+        };
+        /// @brief What the bot does this tick
+        struct Decision {
+            /// @brief Stick direction
+            indie::Event::JoystickDirection direction;
+            /// @brief Drop a bomb
+            bool bomb;
+        };
+
+        /**
+         * @brief Construct a new Bot object
+         *
+         * @param player Index of the player it drives
+         */
+        Bot(int player = 0);
+        /**
+         * @brief Destroy the Bot object
+         *
+         */
+        ~Bot();
+        /**
+         * @brief Choose the input of this tick
+         *
+         * @param board Arena, synchronized for this tick
+         * @param danger Detonation ticks of the armed bombs
+         * @param self State of the driven player
+         * @param replan Search again even if the planned step is still usable
+         * @return Decision Stick direction and bomb button
+         */
+        Decision decide(const indie::board::Board &board, const indie::board::DangerMap &danger, const Situation &self,
+            bool replan = true);
+        /**
+         * @brief Drop the last plan, the next decision searches again
+         *
+         */
+        void forget();
+
+      protected:
+      private:
+        /**
+         * @brief Find the first step of a shortest path
+         *
+         * @param passable Tiles the path may cross, the starting tile excepted
+         * @param from Starting tile
+         * @param goals Tiles to reach
+         * @param distance Set to the length of the path
+         * @return int Tile of the first step, from when it is a goal, -1 when no goal is reachable
+         */
+        int route(const indie::board::Plane &passable, int from, const indie::board::Plane &goals, int &distance);
+        /**
+         * @brief Point the stick toward the center of a tile, lining up with it first
+         *
+         * @param self State of the driven player
+         * @param tile Target tile
+         * @return indie::Event::JoystickDirection Stick direction, JOYSTICK_NONE once on the center
+         */
+        indie::Event::JoystickDirection steer(const Situation &self, int tile) const;
+
+        /**
+         * @brief Index of the driven player
+         *
+         */
+        int _player;
+        /**
+         * @brief Wavefronts of the last search, kept to reuse their storage
+         *
+         */
+        std::vector<indie::board::Plane> _layers;
+        /**
+         * @brief Tile the last plan was made from, -1 when there is none
+         *
+         */
+        int _plannedFrom;
+        /**
+         * @brief First step of the last plan, -1 to stay
+         *
+         */
+        int _plannedStep;
+        /**
+         * @brief Whether the last plan was made standing in danger
+         *
+         */
+        bool _plannedFleeing;
+    };
+} // namespace indie::ai
+
+#endif /* !BOT_HPP_ */
@@ -0,0 +1,219 @@
+/**
+ * @file SimState.cpp
+ * @brief Copyable snapshot of the simulation source file
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "SimState.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include "../board/Board.hpp"
+
+indie::ai::SimState indie::ai::SimState::capture(
+    const std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities,
+    const std::vector<indie::player::Player> &players, indie::ecs::system::Explodable &fuses, std::uint32_t fuseTicks)
+{
+    SimState state;
+
+    std::memset(&state, 0, sizeof(state));
+    state.fuseTicks = fuseTicks;
+    state.playerCount = static_cast<std::uint8_t>(std::min<size_t>(players.size(), SIM_MAX_PLAYERS));
+    for (int index = 0; index < state.playerCount; index++) {
+        const indie::player::Player &player = players[index];
+        state.players[index].alive = player.getIsPlaying() && player.getIsAlive();
+        state.players[index].bombRadius = static_cast<std::uint8_t>(player.getBombRadius());
+        state.players[index].bombStock = static_cast<std::uint8_t>(player.getBombStock());
+        state.players[index].maxBombStock = static_cast<std::uint8_t>(player.getMaxBombStock());
+        state.players[index].speed = static_cast<std::uint16_t>(player.getSpeed());
+    }
+    for (int tile = 0; tile < BOARD_TILES; tile++)
+        state.flames[tile] = fuses.getFlameField().getLifetime(tile);
+    for (auto &entity : entities) {
+        auto transform = entity->getComponent<indie::ecs::component::Transform>(indie::ecs::component::TRANSFORM);
+        if (transform == nullptr)
+            continue;
+        int tile = indie::board::Board::getTile(transform->getX(), transform->getY());
+        indie::ecs::entity::entityType type = entity->getEntityType();
+        if (type == indie::ecs::entity::PLAYER) {
+            auto control =
+                entity->getComponent<indie::ecs::component::PlayerControl>(indie::ecs::component::PLAYERCONTROL);
+            if (control != nullptr && control->getPlayer() >= 0 && control->getPlayer() < state.playerCount) {
+                state.players[control->getPlayer()].x = transform->getX();
+                state.players[control->getPlayer()].y = transform->getY();
+            }
+            continue;
+        }
+        if (tile < 0)
+            continue;
+        if (type == indie::ecs::entity::WALL) {
+            state.tiles[tile] = static_cast<std::uint8_t>((state.tiles[tile] & ~CONTENT) | WALL);
+        } else if (type == indie::ecs::entity::BOXES) {
+            state.tiles[tile] = static_cast<std::uint8_t>((state.tiles[tile] & ~CONTENT) | BOX);
+        } else if (entity->hasCompoType(indie::ecs::component::EXPLODABLE)) {
+            auto bomb = entity->getComponent<indie::ecs::component::Explodable>(indie::ecs::component::EXPLODABLE);
+            if (bomb->getExploded() || state.bombCount >= SIM_MAX_BOMBS)
+                continue;
+            Bomb &copy = state.bombs[state.bombCount++];
+            copy.tile = static_cast<std::uint16_t>(tile);
+            copy.player = static_cast<std::uint8_t>(bomb->getPlayer());
+            copy.reach = static_cast<std::uint8_t>(std::ceil(bomb->getRange() / BLAST_TILE_SIZE));
+            copy.fuse = fuses.getRemainingTicks(bomb);
+        } else if (entity->hasCompoType(indie::ecs::component::COLLECTABLE)) {
+            auto bonus = entity->getComponent<indie::ecs::component::Collectable>(indie::ecs::component::COLLECTABLE);
+            state.tiles[tile] = static_cast<std::uint8_t>(
+                (state.tiles[tile] & CONTENT) | ((bonus->getBonusType() + 1) << BONUS_SHIFT));
+        }
+    }
+    return (state);
+}
+
+int indie::ai::SimState::findBomb(int tile) const
+{
+    for (int bomb = 0; bomb < this->bombCount; bomb++)
+        if (this->bombs[bomb].tile == tile)
+            return (bomb);
+    return (-1);
+}
+
+void indie::ai::SimState::move(int player, indie::Event::JoystickDirection direction)
+{
+    Player &self = this->players[player];
+    float step = static_cast<float>(self.speed) / 50.0f;
+    float dx = 0.0f;
+    float dy = 0.0f;
+
+    switch (direction) {
+        case indie::Event::DOWN: dy = 1.0f; break;
+        case indie::Event::UP: dy = -1.0f; break;
+        case indie::Event::LEFT: dx = -1.0f; break;
+        case indie::Event::RIGHT: dx = 1.0f; break;
+        default: return;
+    }
+    float x = self.x + dx * step;
+    float y = self.y + dy * step;
+    int from = indie::board::Board::getTile(self.x, self.y);
+    int ahead = indie::board::Board::getTile(x + dx * SIM_PLAYER_HALF_SIZE, y + dy * SIM_PLAYER_HALF_SIZE);
+    if (ahead < 0)
+        return;
+    // A player walks off its own bomb, but not onto another one
+    if (ahead != from && ((this->tiles[ahead] & CONTENT) != FLOOR || findBomb(ahead) >= 0))
+        return;
+    self.x = x;
+    self.y = y;
+}
+
+void indie::ai::SimState::detonate()
+{
+    static const int steps[4][2] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
+    int queue[SIM_MAX_BOMBS];
+    bool queued[SIM_MAX_BOMBS] = {};
+    int count = 0;
+
+    for (int bomb = 0; bomb < this->bombCount; bomb++) {
+        if (this->bombs[bomb].fuse == 0) {
+            queued[bomb] = true;
+            queue[count++] = bomb;
+        }
+    }
+    if (count == 0)
+        return;
+    for (int next = 0; next < count; next++) {
+        const Bomb &bomb = this->bombs[queue[next]];
+        int column = bomb.tile % BOARD_COLUMNS;
+        int row = bomb.tile / BOARD_COLUMNS;
+
+        this->flames[bomb.tile] = FLAME_TICKS;
+        for (auto &direction : steps) {
+            for (int distance = 1; distance <= bomb.reach; distance++) {
+                int x = column + direction[0] * distance;
+                int y = row + direction[1] * distance;
+                if (x < 0 || x >= BOARD_COLUMNS || y < 0 || y >= BOARD_ROWS)
+                    break;
+                int tile = y * BOARD_COLUMNS + x;
+                if ((this->tiles[tile] & CONTENT) == WALL)
+                    break;
+                // The rays burn through the boxes, the bonus under them stays
+                this->tiles[tile] = static_cast<std::uint8_t>(this->tiles[tile] & ~CONTENT);
+                this->flames[tile] = FLAME_TICKS;
+                int chained = findBomb(tile);
+                if (chained >= 0 && !queued[chained]) {
+                    queued[chained] = true;
+                    queue[count++] = chained;
+                }
+            }
+        }
+    }
+    int kept = 0;
+    for (int bomb = 0; bomb < this->bombCount; bomb++) {
+        if (queued[bomb]) {
+            Player &owner = this->players[this->bombs[bomb].player % SIM_MAX_PLAYERS];
+            owner.bombStock++;
+        } else {
+            this->bombs[kept++] = this->bombs[bomb];
+        }
+    }
+    this->bombCount = static_cast<std::uint8_t>(kept);
+}
+
+void indie::ai::SimState::step(const Action *actions)
+{
+    for (auto &flame : this->flames)
+        if (flame > 0)
+            flame--;
+    for (int player = 0; player < this->playerCount; player++) {
+        Player &self = this->players[player];
+        if (!self.alive)
+            continue;
+        move(player, actions[player].direction);
+        int tile = indie::board::Board::getTile(self.x, self.y);
+        if (tile < 0)
+            continue;
+        if (actions[player].bomb && self.bombStock > 0 && findBomb(tile) < 0 && this->bombCount < SIM_MAX_BOMBS) {
+            this->bombs[this->bombCount++] = {static_cast<std::uint16_t>(tile), static_cast<std::uint8_t>(player),
+                self.bombRadius, this->fuseTicks};
+            self.bombStock--;
+        }
+    }
+    for (int bomb = 0; bomb < this->bombCount; bomb++)
+        if (this->bombs[bomb].fuse > 0)
+            this->bombs[bomb].fuse--;
+    detonate();
+    for (int player = 0; player < this->playerCount; player++) {
+        Player &self = this->players[player];
+        int tile = indie::board::Board::getTile(self.x, self.y);
+        if (!self.alive || tile < 0)
+            continue;
+        if (this->flames[tile] > 0) {
+            self.alive = false;
+            continue;
+        }
+        if ((this->tiles[tile] & CONTENT) != FLOOR)
+            continue;
+        switch ((this->tiles[tile] >> BONUS_SHIFT) - 1) {
+            case indie::ecs::component::BOMBUP:
+                self.bombStock++;
+                self.maxBombStock++;
+                break;
+            case indie::ecs::component::SPEEDUP: self.speed += 3; break;
+            case indie::ecs::component::FIREUP: self.bombRadius++; break;
+            default: break;
+        }
+        this->tiles[tile] &= CONTENT;
+    }
+    this->tick++;
+}
+
+int indie::ai::SimState::alive() const
+{
+    int count = 0;
+
+    for (int player = 0; player < this->playerCount; player++)
+        if (this->players[player].alive)
+            count++;
+    return (count);
+}
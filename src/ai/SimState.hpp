@@ -0,0 +1,154 @@
+/**
+ * @file SimState.hpp
+ * @brief Copyable snapshot of the simulation header file
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef SIMSTATE_HPP_
+#define SIMSTATE_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include "../board/Bitboard.hpp"
+#include "../ecs/entity/Entity.hpp"
+#include "../ecs/system/Explodable/Explodable.hpp"
+#include "../player/Player.hpp"
+#include "events.hpp"
+
+/// @brief Players of a snapshot
+#define SIM_MAX_PLAYERS MAX_PLAYERS
+/// @brief Bombs of a snapshot, the later ones are dropped
+#define SIM_MAX_BOMBS 64
+/// @brief Half the width of a player, the tile ahead of it is tested against this edge
+#define SIM_PLAYER_HALF_SIZE 0.2f
+
+namespace indie::ai
+{
+    /**
+     * @brief Plain data copy of the state of a match, with a tile level kernel stepping it
+     *
+     * Only fixed size arrays of integers and floats, under 2.5 kB with 64 players, so a clone is a single memcpy
+     * and a search bot can roll thousands of futures out of it. The kernel follows the rules of the game on the tile
+     * grid: rays stopped by the walls and burning through the boxes, chain reactions in the same tick, flames killing
+     * the players and the bonuses picked on their tile. Collisions are reduced to the tile ahead of the player.
+     * GameScreen checks it against the systems every SIM_CHECK_PERIOD_TICKS ticks.
+     */
+    struct SimState {
+        /// @brief Content of a tile, the bonus hidden under a box is kept in the high bits
+        enum Tile : std::uint8_t { FLOOR = 0, WALL = 1, BOX = 2 };
+        /// @brief Mask of the content of a tile
+        static constexpr std::uint8_t CONTENT = 3;
+        /// @brief Shift of the bonus of a tile, stored as bonusType + 1
+        static constexpr int BONUS_SHIFT = 2;
+
+        /// @brief A player
+        struct Player {
+            /// @brief World x
+            float x;
+            /// @brief World y
+            float y;
+            /// @brief Is the player still in the match
+            bool alive;
+            /// @brief Reach of its bombs, in tiles
+            std::uint8_t bombRadius;
+            /// @brief Bombs it can still drop
+            std::uint8_t bombStock;
+            /// @brief Bombs it can hold
+            std::uint8_t maxBombStock;
+            /// @brief Speed, the player moves speed / 50 units per tick
+            std::uint16_t speed;
+        };
+        /// @brief An armed bomb
+        struct Bomb {
+            /// @brief Tile of the bomb
+            std::uint16_t tile;
+            /// @brief Player who dropped it
+            std::uint8_t player;
+            /// @brief Length of its rays, in tiles
+            std::uint8_t reach;
+            /// @brief Ticks before it explodes
+            std::uint32_t fuse;
+        };
+        /// @brief Input of a player for one tick
+        struct Action {
+            /// @brief Stick direction
+            indie::Event::JoystickDirection direction;
+            /// @brief Drop a bomb
+            bool bomb;
+        };
+
+        /**
+         * @brief Copy the state of a running match
+         *
+         * @param entities Entities of the match
+         * @param players Stats of the players
+         * @param fuses System owning the fuses and the flames
+         * @param fuseTicks Fuse of the bombs dropped in the snapshot
+         * @return SimState The snapshot
+         */
+        static SimState capture(const std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities,
+            const std::vector<indie::player::Player> &players, indie::ecs::system::Explodable &fuses,
+            std::uint32_t fuseTicks);
+        /**
+         * @brief Advance the snapshot by one tick
+         *
+         * @param actions Input of each player, SIM_MAX_PLAYERS entries
+         */
+        void step(const Action *actions);
+        /**
+         * @brief Count the players still alive
+         *
+         * @return int Players alive
+         */
+        int alive() const;
+
+        /// @brief Content of each tile
+        std::uint8_t tiles[BOARD_TILES];
+        /// @brief Remaining lifetime of the flames of each tile
+        std::uint8_t flames[BOARD_TILES];
+        /// @brief Players, by index
+        Player players[SIM_MAX_PLAYERS];
+        /// @brief Armed bombs, the first bombCount are valid
+        Bomb bombs[SIM_MAX_BOMBS];
+        /// @brief Number of players
+        std::uint8_t playerCount;
+        /// @brief Number of armed bombs
+        std::uint8_t bombCount;
+        /// @brief Fuse of the bombs dropped by the kernel
+        std::uint32_t fuseTicks;
+        /// @brief Ticks stepped since the capture
+        std::uint32_t tick;
+
+      private:
+        /**
+         * @brief Move a player one step, stopping before a blocked tile
+         *
+         * @param player Player index
+         * @param direction Stick direction
+         */
+        void move(int player, indie::Event::JoystickDirection direction);
+        /**
+         * @brief Explode the bombs whose fuse ended, and those their rays reach
+         *
+         */
+        void detonate();
+        /**
+         * @brief Find the bomb lying on a tile
+         *
+         * @param tile Tile index
+         * @return int Bomb index, -1 when there is none
+         */
+        int findBomb(int tile) const;
+    };
+
+    static_assert(std::is_trivially_copyable_v<SimState>, "A snapshot must be copyable with memcpy");
+    static_assert(sizeof(SimState) <= 2560, "A snapshot must stay small enough to clone per rollout");
+} // namespace indie::ai
+
+#endif /* !SIMSTATE_HPP_ */
@@ -0,0 +1,87 @@
+/**
+ * @file AudioMixer.cpp
+ * @brief Audio thread playing the sound effects requested by the game
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "AudioMixer.hpp"
+#include <algorithm>
+#include <chrono>
+
+indie::audio::AudioMixer::AudioMixer() : _running(false)
+{
+    for (auto &volume : this->_volumes)
+        volume = 1.0f;
+}
+
+indie::audio::AudioMixer::~AudioMixer()
+{
+    this->stop();
+}
+
+indie::audio::SoundBank &indie::audio::AudioMixer::getBank()
+{
+    return (this->_bank);
+}
+
+void indie::audio::AudioMixer::start()
+{
+    if (this->_running)
+        return;
+    this->_running = true;
+    this->_thread = std::thread(&indie::audio::AudioMixer::mix, this);
+}
+
+void indie::audio::AudioMixer::stop()
+{
+    this->_running = false;
+    if (this->_thread.joinable())
+        this->_thread.join();
+    this->_bank.unload();
+}
+
+bool indie::audio::AudioMixer::post(int effect, SoundCategory category, float volume, float priority)
+{
+    if (effect == SoundBank::NOT_LOADED || category >= SoundCategory::COUNT)
+        return (false);
+    return (this->_commands.push({effect, category, volume, priority}));
+}
+
+void indie::audio::AudioMixer::setCategoryVolume(SoundCategory category, float volume)
+{
+    if (category < SoundCategory::COUNT)
+        this->_volumes[static_cast<std::size_t>(category)] = volume;
+}
+
+float indie::audio::AudioMixer::getCategoryVolume(SoundCategory category) const
+{
+    if (category >= SoundCategory::COUNT)
+        return (0.0f);
+    return (this->_volumes[static_cast<std::size_t>(category)]);
+}
+
+void indie::audio::AudioMixer::mix()
+{
+    std::array<Command, BATCH> batch;
+
+    while (this->_running) {
+        std::size_t count = 0;
+
+        while (count < BATCH && this->_commands.pop(batch[count]))
+            count++;
+        if (count == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(AUDIO_MIXER_IDLE_MS));
+            continue;
+        }
+        // The most important sounds of a burst get the free voices, the others can only steal less important ones
+        std::sort(batch.begin(), batch.begin() + count,
+            [](const Command &a, const Command &b) { return (a.priority > b.priority); });
+        for (std::size_t i = 0; i < count; i++)
+            this->_bank.play(batch[i].effect,
+                batch[i].volume * this->_volumes[static_cast<std::size_t>(batch[i].category)], batch[i].priority);
+    }
+}
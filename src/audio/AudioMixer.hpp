@@ -0,0 +1,148 @@
+/**
+ * @file AudioMixer.hpp
+ * @brief Audio thread playing the sound effects requested by the game
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef AUDIOMIXER_HPP_
+#define AUDIOMIXER_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+
+#include "../tools/SpscRing.hpp"
+#include "SoundBank.hpp"
+#include "SoundCategory.hpp"
+
+/// @brief Time the audio thread sleeps when there is no command
+#define AUDIO_MIXER_IDLE_MS 1
+
+namespace indie
+{
+    namespace audio
+    {
+        /**
+         * @brief Audio thread playing the sound effects requested by the game
+         *
+         * The game thread posts play commands into a lock-free queue and never waits on audio. The audio thread drains
+         * the queue, plays the most important commands of a batch first, scales them by the volume of their category
+         * and lets the sound bank steal voices by priority. It is the only thread touching the bank once started.
+         *
+         */
+        class AudioMixer {
+          public:
+            /**
+             * @brief A request to play a sound effect
+             *
+             */
+            struct Command {
+                /// @brief Id of the effect in the bank
+                int effect;
+                /// @brief Category of the effect
+                SoundCategory category;
+                /// @brief Volume of the effect, from 0 to 1, before the category volume
+                float volume;
+                /// @brief Priority of the sound, higher is more important
+                float priority;
+            };
+            /**
+             * @brief Construct a new AudioMixer object
+             *
+             */
+            AudioMixer();
+            /**
+             * @brief Destroy the AudioMixer object, stopping the audio thread
+             *
+             */
+            ~AudioMixer();
+            AudioMixer(const AudioMixer &) = delete;
+            AudioMixer &operator=(const AudioMixer &) = delete;
+            /**
+             * @brief Get the bank of effects, to load them before start
+             *
+             * @return SoundBank& The bank
+             */
+            SoundBank &getBank();
+            /**
+             * @brief Start the audio thread
+             *
+             */
+            void start();
+            /**
+             * @brief Stop the audio thread and unload the bank
+             *
+             */
+            void stop();
+            /**
+             * @brief Request an effect to be played, from the game thread only
+             *
+             * @param effect Id of the effect in the bank
+             * @param category Category of the effect
+             * @param volume Volume of the effect, from 0 to 1
+             * @param priority Priority of the sound, higher is more important
+             * @return true If the command is queued
+             * @return false If the queue is full and the sound is dropped
+             */
+            bool post(int effect, SoundCategory category, float volume = 1.0f, float priority = 0.0f);
+            /**
+             * @brief Set the volume of a category
+             *
+             * @param category The category
+             * @param volume Volume, from 0 to 1
+             */
+            void setCategoryVolume(SoundCategory category, float volume);
+            /**
+             * @brief Get the volume of a category
+             *
+             * @param category The category
+             * @return float Volume, from 0 to 1
+             */
+            float getCategoryVolume(SoundCategory category) const;
+
+          private:
+            /**
+             * @brief Most commands handled in one batch, the rest waits for the next one
+             *
+             */
+            static constexpr std::size_t BATCH = 32;
+            /**
+             * @brief Audio thread loop
+             *
+             */
+            void mix();
+            /**
+             * @brief Effects and their voices
+             *
+             */
+            SoundBank _bank;
+            /**
+             * @brief Commands posted by the game thread
+             *
+             */
+            indie::tools::SpscRing<Command, 256> _commands;
+            /**
+             * @brief Volume of each category
+             *
+             */
+            std::array<std::atomic<float>, static_cast<std::size_t>(SoundCategory::COUNT)> _volumes;
+            /**
+             * @brief Audio thread
+             *
+             */
+            std::thread _thread;
+            /**
+             * @brief Is the audio thread running?
+             *
+             */
+            std::atomic<bool> _running;
+        };
+    } // namespace audio
+} // namespace indie
+
+#endif /* !AUDIOMIXER_HPP_ */
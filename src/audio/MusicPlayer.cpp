@@ -0,0 +1,107 @@
+/**
+ * @file MusicPlayer.cpp
+ * @brief Streamed background music fed from its own thread
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "MusicPlayer.hpp"
+#include <algorithm>
+#include <chrono>
+
+indie::audio::MusicPlayer::MusicPlayer() : _running(false), _requested(-1), _fade(0), _volume(1)
+{
+}
+
+indie::audio::MusicPlayer::~MusicPlayer()
+{
+    this->stop();
+}
+
+int indie::audio::MusicPlayer::addTrack(const std::string &path)
+{
+    for (std::size_t i = 0; i < this->_tracks.size(); i++)
+        if (this->_tracks[i].path == path)
+            return (static_cast<int>(i));
+    if (this->_running)
+        return (-1);
+    indie::raylib::Music::setStreamBufferSize(MUSIC_STREAM_BUFFER_FRAMES);
+    Track track = {path, indie::raylib::Music(path), 0, false};
+    track.music.setLooping(true);
+    this->_tracks.push_back(track);
+    return (static_cast<int>(this->_tracks.size() - 1));
+}
+
+void indie::audio::MusicPlayer::start()
+{
+    if (this->_running)
+        return;
+    this->_running = true;
+    this->_thread = std::thread(&indie::audio::MusicPlayer::feed, this);
+}
+
+void indie::audio::MusicPlayer::stop()
+{
+    this->_running = false;
+    if (this->_thread.joinable())
+        this->_thread.join();
+    for (auto &track : this->_tracks) {
+        if (track.playing)
+            track.music.stopStream();
+        track.music.unloadStream();
+    }
+    this->_tracks.clear();
+}
+
+void indie::audio::MusicPlayer::play(int track, float fadeSeconds)
+{
+    this->_fade = fadeSeconds;
+    this->_requested = track;
+}
+
+void indie::audio::MusicPlayer::setVolume(float volume)
+{
+    this->_volume = volume;
+}
+
+float indie::audio::MusicPlayer::getVolume() const
+{
+    return (this->_volume);
+}
+
+void indie::audio::MusicPlayer::feed()
+{
+    auto last = std::chrono::steady_clock::now();
+
+    while (this->_running) {
+        auto now = std::chrono::steady_clock::now();
+        float elapsed = std::chrono::duration<float>(now - last).count();
+        float fade = this->_fade;
+        float step = fade > 0 ? elapsed / fade : 1.0f;
+        int requested = this->_requested;
+        float volume = this->_volume;
+
+        last = now;
+        for (int i = 0; i < static_cast<int>(this->_tracks.size()); i++) {
+            Track &track = this->_tracks[i];
+            float goal = (i == requested) ? 1.0f : 0.0f;
+
+            track.gain = goal > track.gain ? std::min(goal, track.gain + step) : std::max(goal, track.gain - step);
+            if (track.gain > 0 && !track.playing) {
+                track.music.playStream();
+                track.playing = true;
+            } else if (track.gain <= 0 && track.playing) {
+                track.music.stopStream();
+                track.playing = false;
+            }
+            if (track.playing) {
+                track.music.setVolume(track.gain * volume);
+                track.music.updateStream();
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(MUSIC_FEED_INTERVAL_MS));
+    }
+}
@@ -0,0 +1,143 @@
+/**
+ * @file MusicPlayer.hpp
+ * @brief Streamed background music fed from its own thread
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef MUSICPLAYER_HPP_
+#define MUSICPLAYER_HPP_
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../raylib/Raylib.hpp"
+
+/// @brief Frames per stream buffer, raylib double buffers it: about 90 ms of 44.1 kHz audio per buffer
+#define MUSIC_STREAM_BUFFER_FRAMES 4096
+/// @brief Time the feeder thread sleeps between two refills, well under the length of a buffer
+#define MUSIC_FEED_INTERVAL_MS 10
+
+namespace indie
+{
+    namespace audio
+    {
+        /**
+         * @brief Streamed background music fed from its own thread
+         *
+         * Tracks are decoded a buffer at a time instead of being fully decoded at startup. A feeder thread refills the
+         * stream buffers, loops the tracks without a gap and crossfades from one track to the next. The feeder thread
+         * is the only one calling raylib on the streams; the other threads only change the requested track and volume.
+         *
+         */
+        class MusicPlayer {
+          public:
+            /**
+             * @brief Construct a new MusicPlayer object
+             *
+             */
+            MusicPlayer();
+            /**
+             * @brief Destroy the MusicPlayer object, stopping the feeder thread
+             *
+             */
+            ~MusicPlayer();
+            MusicPlayer(const MusicPlayer &) = delete;
+            MusicPlayer &operator=(const MusicPlayer &) = delete;
+            /**
+             * @brief Open a track, the audio device must be initialized and the player not started
+             *
+             * @param path Path of the music file
+             * @return int Id of the track, the same id if the file is already open
+             */
+            int addTrack(const std::string &path);
+            /**
+             * @brief Start the feeder thread
+             *
+             */
+            void start();
+            /**
+             * @brief Stop the feeder thread and close the tracks
+             *
+             */
+            void stop();
+            /**
+             * @brief Crossfade to a track
+             *
+             * @param track Id of the track
+             * @param fadeSeconds Length of the crossfade
+             */
+            void play(int track, float fadeSeconds = 1.5f);
+            /**
+             * @brief Set the master music volume
+             *
+             * @param volume Volume, from 0 to 1
+             */
+            void setVolume(float volume);
+            /**
+             * @brief Get the master music volume
+             *
+             * @return float Volume, from 0 to 1
+             */
+            float getVolume() const;
+
+          private:
+            /**
+             * @brief An open track
+             *
+             */
+            struct Track {
+                /// @brief Path of the music file
+                std::string path;
+                /// @brief Music stream
+                indie::raylib::Music music;
+                /// @brief Crossfade gain, from 0 to 1
+                float gain;
+                /// @brief Is the stream playing?
+                bool playing;
+            };
+            /**
+             * @brief Feeder thread loop
+             *
+             */
+            void feed();
+            /**
+             * @brief Open tracks, only touched by the feeder thread once started
+             *
+             */
+            std::vector<Track> _tracks;
+            /**
+             * @brief Feeder thread
+             *
+             */
+            std::thread _thread;
+            /**
+             * @brief Is the feeder thread running?
+             *
+             */
+            std::atomic<bool> _running;
+            /**
+             * @brief Requested track, -1 for silence
+             *
+             */
+            std::atomic<int> _requested;
+            /**
+             * @brief Length of the current crossfade, in seconds
+             *
+             */
+            std::atomic<float> _fade;
+            /**
+             * @brief Master music volume
+             *
+             */
+            std::atomic<float> _volume;
+        };
+    } // namespace audio
+} // namespace indie
+
+#endif /* !MUSICPLAYER_HPP_ */
@@ -0,0 +1,96 @@
+/**
+ * @file SoundBank.cpp
+ * @brief Sound effects decoded once, played through a fixed pool of voices
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "SoundBank.hpp"
+#include "../profiling/Counters.hpp"
+
+indie::audio::SoundBank::SoundBank()
+{
+}
+
+indie::audio::SoundBank::~SoundBank()
+{
+    this->unload();
+}
+
+int indie::audio::SoundBank::load(const std::string &path, std::size_t voices)
+{
+    int id = find(path);
+    ::Wave wave = {};
+
+    if (id != NOT_LOADED)
+        return (id);
+    wave = indie::raylib::Sound::loadWave(path);
+    id = load(path, wave, voices);
+    indie::raylib::Sound::unloadWave(wave);
+    return (id);
+}
+
+int indie::audio::SoundBank::load(const std::string &path, const ::Wave &wave, std::size_t voices)
+{
+    int id = find(path);
+    Effect effect = {path, {}, {}, 0};
+
+    if (id != NOT_LOADED)
+        return (id);
+    COUNTER_INC(SOUND_LOADS);
+    for (std::size_t i = 0; i < voices || i == 0; i++)
+        effect.voices.push_back(indie::raylib::Sound::loadFromWave(wave));
+    effect.priorities.resize(effect.voices.size(), 0.0f);
+    this->_effects.push_back(std::move(effect));
+    return (static_cast<int>(this->_effects.size() - 1));
+}
+
+int indie::audio::SoundBank::find(const std::string &path) const
+{
+    for (std::size_t i = 0; i < this->_effects.size(); i++)
+        if (this->_effects[i].path == path)
+            return (static_cast<int>(i));
+    return (NOT_LOADED);
+}
+
+bool indie::audio::SoundBank::play(int id, float volume, float priority)
+{
+    if (id < 0 || static_cast<std::size_t>(id) >= this->_effects.size())
+        return (false);
+    Effect &effect = this->_effects[id];
+    std::size_t voice = effect.next;
+    bool found = false;
+
+    for (std::size_t i = 0; i < effect.voices.size(); i++) {
+        std::size_t candidate = (effect.next + i) % effect.voices.size();
+        if (!indie::raylib::Sound::isPlaying(effect.voices[candidate])) {
+            voice = candidate;
+            found = true;
+            break;
+        }
+        if (effect.priorities[candidate] < effect.priorities[voice])
+            voice = candidate;
+    }
+    if (!found && effect.priorities[voice] > priority)
+        return (false);
+    effect.next = (voice + 1) % effect.voices.size();
+    effect.priorities[voice] = priority;
+    indie::raylib::Sound::stop(effect.voices[voice]);
+    indie::raylib::Sound::setVolume(effect.voices[voice], volume);
+    indie::raylib::Sound::play(effect.voices[voice]);
+    return (true);
+}
+
+void indie::audio::SoundBank::unload()
+{
+    for (auto &effect : this->_effects) {
+        for (auto &voice : effect.voices) {
+            indie::raylib::Sound::stop(voice);
+            indie::raylib::Sound::unload(voice);
+        }
+    }
+    this->_effects.clear();
+}
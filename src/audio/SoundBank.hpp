@@ -0,0 +1,112 @@
+/**
+ * @file SoundBank.hpp
+ * @brief Sound effects decoded once, played through a fixed pool of voices
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef SOUNDBANK_HPP_
+#define SOUNDBANK_HPP_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "../raylib/Raylib.hpp"
+
+namespace indie
+{
+    namespace audio
+    {
+        /**
+         * @brief Sound effects decoded once, played through a fixed pool of voices
+         *
+         * Every effect is decoded once at load time into a fixed number of voices, so the same effect can overlap
+         * itself. Playing only picks a voice: no file access and no allocation. When every voice of an effect is busy
+         * the voice with the lowest priority is stolen, unless the new sound matters even less.
+         *
+         */
+        class SoundBank {
+          public:
+            /// @brief Returned by find when the effect is not loaded
+            static constexpr int NOT_LOADED = -1;
+            /**
+             * @brief Construct a new empty SoundBank object
+             *
+             */
+            SoundBank();
+            /**
+             * @brief Destroy the SoundBank object, unloading every effect
+             *
+             */
+            ~SoundBank();
+            SoundBank(const SoundBank &) = delete;
+            SoundBank &operator=(const SoundBank &) = delete;
+            /**
+             * @brief Decode an effect and create its voices, the audio device must be initialized
+             *
+             * @param path Path of the sound file
+             * @param voices Number of times the effect can play at once
+             * @return int Id of the effect, the same id if it is already loaded
+             */
+            int load(const std::string &path, std::size_t voices = 4);
+            /**
+             * @brief Create the voices of an effect decoded beforehand, the audio device must be initialized
+             *
+             * @param path Path of the sound file, naming the effect
+             * @param wave Decoded samples, still owned by the caller
+             * @param voices Number of times the effect can play at once
+             * @return int Id of the effect, the same id if it is already loaded
+             */
+            int load(const std::string &path, const ::Wave &wave, std::size_t voices = 4);
+            /**
+             * @brief Get the id of a loaded effect
+             *
+             * @param path Path of the sound file
+             * @return int Id of the effect, NOT_LOADED if it has not been loaded
+             */
+            int find(const std::string &path) const;
+            /**
+             * @brief Play an effect on one of its voices
+             *
+             * @param id Id of the effect
+             * @param volume Volume, from 0 to 1
+             * @param priority Priority of the sound, a busy voice is only stolen by a sound at least as important
+             * @return true If a voice plays the sound
+             * @return false If every voice is busy with more important sounds
+             */
+            bool play(int id, float volume = 1.0f, float priority = 0.0f);
+            /**
+             * @brief Stop and unload every effect
+             *
+             */
+            void unload();
+
+          private:
+            /**
+             * @brief A decoded effect and its voices
+             *
+             */
+            struct Effect {
+                /// @brief Path of the sound file
+                std::string path;
+                /// @brief Voices of the effect
+                std::vector<::Sound> voices;
+                /// @brief Priority of the sound played by each voice
+                std::vector<float> priorities;
+                /// @brief First voice looked at, so equal priorities are stolen oldest first
+                std::size_t next;
+            };
+            /**
+             * @brief Loaded effects, by id
+             *
+             */
+            std::vector<Effect> _effects;
+        };
+    } // namespace audio
+} // namespace indie
+
+#endif /* !SOUNDBANK_HPP_ */
@@ -0,0 +1,32 @@
+/**
+ * @file SoundCategory.hpp
+ * @brief Categories of sound effects, each with its own volume
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef SOUNDCATEGORY_HPP_
+#define SOUNDCATEGORY_HPP_
+
+#include <cstdint>
+
+namespace indie
+{
+    namespace audio
+    {
+        /// @brief Categories of sound effects, each with its own volume
+        enum class SoundCategory : std::uint8_t {
+            /// Sounds of the match, such as explosions
+            GAMEPLAY,
+            /// Menu feedback sounds
+            INTERFACE,
+            /// Number of categories
+            COUNT
+        };
+    } // namespace audio
+} // namespace indie
+
+#endif /* !SOUNDCATEGORY_HPP_ */
@@ -0,0 +1,354 @@
+/*
+** EPITECH PROJECT, 2022
+** Bomberman
+** File description:
+** Bitboard
+*/
+
+#ifndef BITBOARD_HPP_
+#define BITBOARD_HPP_
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+/// @brief Columns of the arena
+#define BOARD_COLUMNS 21
+/// @brief Rows of the arena
+#define BOARD_ROWS 21
+/// @brief Tiles of the arena
+#define BOARD_TILES (BOARD_COLUMNS * BOARD_ROWS)
+/// @brief 64 bits words of a plane, the arena fits in one 512 bits value
+#define BOARD_WORDS 8
+
+static_assert(BOARD_TILES <= BOARD_WORDS * 64, "The arena does not fit in a bitboard plane");
+
+namespace indie::board
+{
+    /**
+     * @brief One bit per tile of the arena, tile = row * BOARD_COLUMNS + column
+     *
+     * Moving every bit of the plane one tile in a direction is a shift of the whole 512 bits value: by 1 for the
+     * columns, by BOARD_COLUMNS for the rows. The shifts and the boolean operators work on 128 bits lanes when SSE2
+     * is available, on 64 bits words otherwise.
+     */
+    class Plane {
+      public:
+        /**
+         * @brief Construct a new empty Plane object
+         *
+         */
+        Plane() : _words{}
+        {
+        }
+        /**
+         * @brief Plane with every tile of the arena set
+         *
+         * @return const Plane& Arena mask
+         */
+        static const Plane &arena()
+        {
+            static const Plane mask = makeMask(-1);
+
+            return (mask);
+        }
+        /**
+         * @brief Test a tile
+         *
+         * @param tile Tile index
+         * @return true If the tile is set
+         */
+        bool test(int tile) const
+        {
+            return (((_words[tile >> 6] >> (tile & 63)) & 1) != 0);
+        }
+        /**
+         * @brief Set a tile
+         *
+         * @param tile Tile index
+         */
+        void set(int tile)
+        {
+            _words[tile >> 6] |= std::uint64_t(1) << (tile & 63);
+        }
+        /**
+         * @brief Clear a tile
+         *
+         * @param tile Tile index
+         */
+        void reset(int tile)
+        {
+            _words[tile >> 6] &= ~(std::uint64_t(1) << (tile & 63));
+        }
+        /**
+         * @brief Clear every tile
+         *
+         */
+        void clear()
+        {
+            _words.fill(0);
+        }
+        /**
+         * @brief Tell if a tile is set
+         *
+         * @return true If at least one tile is set
+         */
+        bool any() const
+        {
+            std::uint64_t bits = 0;
+
+            for (auto word : _words)
+                bits |= word;
+            return (bits != 0);
+        }
+        /**
+         * @brief Count the tiles set
+         *
+         * @return int Number of tiles set
+         */
+        int count() const
+        {
+            int total = 0;
+
+            for (auto word : _words)
+                total += std::popcount(word);
+            return (total);
+        }
+        /**
+         * @brief Get the lowest tile set
+         *
+         * @return int Tile index, -1 when the plane is empty
+         */
+        int first() const
+        {
+            for (std::size_t word = 0; word < BOARD_WORDS; word++)
+                if (_words[word] != 0)
+                    return (static_cast<int>(word * 64 + std::countr_zero(_words[word])));
+            return (-1);
+        }
+        /**
+         * @brief Call a function on each tile set, in increasing order
+         *
+         * @param function Called with the tile index
+         */
+        template <typename F> void forEach(F &&function) const
+        {
+            for (std::size_t word = 0; word < BOARD_WORDS; word++) {
+                for (std::uint64_t bits = _words[word]; bits != 0; bits &= bits - 1)
+                    function(static_cast<int>(word * 64 + std::countr_zero(bits)));
+            }
+        }
+
+        bool operator==(const Plane &other) const
+        {
+            return (_words == other._words);
+        }
+        Plane operator|(const Plane &other) const
+        {
+            Plane result;
+
+#if defined(__SSE2__)
+            for (std::size_t lane = 0; lane < BOARD_WORDS; lane += 2)
+                store(result, lane, _mm_or_si128(load(*this, lane), load(other, lane)));
+#else
+            for (std::size_t word = 0; word < BOARD_WORDS; word++)
+                result._words[word] = _words[word] | other._words[word];
+#endif
+            return (result);
+        }
+        Plane operator&(const Plane &other) const
+        {
+            Plane result;
+
+#if defined(__SSE2__)
+            for (std::size_t lane = 0; lane < BOARD_WORDS; lane += 2)
+                store(result, lane, _mm_and_si128(load(*this, lane), load(other, lane)));
+#else
+            for (std::size_t word = 0; word < BOARD_WORDS; word++)
+                result._words[word] = _words[word] & other._words[word];
+#endif
+            return (result);
+        }
+        Plane &operator|=(const Plane &other)
+        {
+            *this = *this | other;
+            return (*this);
+        }
+        /**
+         * @brief Tiles of this plane that are not in another
+         *
+         * @param other Tiles to remove
+         * @return Plane this & ~other
+         */
+        Plane without(const Plane &other) const
+        {
+            Plane result;
+
+#if defined(__SSE2__)
+            for (std::size_t lane = 0; lane < BOARD_WORDS; lane += 2)
+                store(result, lane, _mm_andnot_si128(load(other, lane), load(*this, lane)));
+#else
+            for (std::size_t word = 0; word < BOARD_WORDS; word++)
+                result._words[word] = _words[word] & ~other._words[word];
+#endif
+            return (result);
+        }
+        /**
+         * @brief Move every tile one column right, the last column falls off
+         *
+         * @return Plane Shifted plane
+         */
+        Plane east() const
+        {
+            static const Plane mask = makeMask(0);
+
+            return (shiftUp(1) & mask);
+        }
+        /**
+         * @brief Move every tile one column left, the first column falls off
+         *
+         * @return Plane Shifted plane
+         */
+        Plane west() const
+        {
+            static const Plane mask = makeMask(BOARD_COLUMNS - 1);
+
+            return (shiftDown(1) & mask);
+        }
+        /**
+         * @brief Move every tile one row down, toward the higher rows
+         *
+         * @return Plane Shifted plane
+         */
+        Plane south() const
+        {
+            return (shiftUp(BOARD_COLUMNS) & arena());
+        }
+        /**
+         * @brief Move every tile one row up, toward the row 0
+         *
+         * @return Plane Shifted plane
+         */
+        Plane north() const
+        {
+            return (shiftDown(BOARD_COLUMNS));
+        }
+        /**
+         * @brief Tiles next to a tile of this plane, in the four directions
+         *
+         * @return Plane Neighbour tiles
+         */
+        Plane adjacent() const
+        {
+            return (east() | west() | north() | south());
+        }
+
+      private:
+        /**
+         * @brief Arena mask without a column
+         *
+         * @param column Column left empty, -1 to keep them all
+         * @return Plane The mask
+         */
+        static Plane makeMask(int column)
+        {
+            Plane mask;
+
+            for (int tile = 0; tile < BOARD_TILES; tile++)
+                if (tile % BOARD_COLUMNS != column)
+                    mask.set(tile);
+            return (mask);
+        }
+        /**
+         * @brief Shift the 512 bits value toward the higher tiles
+         *
+         * @param bits Shift, between 1 and 63
+         * @return Plane Shifted plane
+         */
+        Plane shiftUp(int bits) const
+        {
+            Plane result;
+
+#if defined(__SSE2__)
+            __m128i count = _mm_cvtsi32_si128(bits);
+            __m128i carryCount = _mm_cvtsi32_si128(64 - bits);
+            __m128i previous = _mm_setzero_si128();
+
+            for (std::size_t lane = 0; lane < BOARD_WORDS; lane += 2) {
+                __m128i current = load(*this, lane);
+                __m128i carry = _mm_srl_epi64(current, carryCount);
+                // The low word carries into the high word, the high word of the previous lane into the low word
+                __m128i in = _mm_or_si128(_mm_slli_si128(carry, 8), _mm_srli_si128(previous, 8));
+
+                store(result, lane, _mm_or_si128(_mm_sll_epi64(current, count), in));
+                previous = carry;
+            }
+#else
+            std::uint64_t carry = 0;
+
+            for (std::size_t word = 0; word < BOARD_WORDS; word++) {
+                result._words[word] = (_words[word] << bits) | carry;
+                carry = _words[word] >> (64 - bits);
+            }
+#endif
+            return (result);
+        }
+        /**
+         * @brief Shift the 512 bits value toward the lower tiles
+         *
+         * @param bits Shift, between 1 and 63
+         * @return Plane Shifted plane
+         */
+        Plane shiftDown(int bits) const
+        {
+            Plane result;
+
+#if defined(__SSE2__)
+            __m128i count = _mm_cvtsi32_si128(bits);
+            __m128i carryCount = _mm_cvtsi32_si128(64 - bits);
+            __m128i next = _mm_setzero_si128();
+
+            for (std::size_t lane = BOARD_WORDS; lane > 0; lane -= 2) {
+                __m128i current = load(*this, lane - 2);
+                __m128i carry = _mm_sll_epi64(current, carryCount);
+                // The high word carries into the low word, the low word of the next lane into the high word
+                __m128i in = _mm_or_si128(_mm_srli_si128(carry, 8), _mm_slli_si128(next, 8));
+
+                store(result, lane - 2, _mm_or_si128(_mm_srl_epi64(current, count), in));
+                next = carry;
+            }
+#else
+            std::uint64_t carry = 0;
+
+            for (std::size_t word = BOARD_WORDS; word > 0; word--) {
+                result._words[word - 1] = (_words[word - 1] >> bits) | carry;
+                carry = _words[word - 1] << (64 - bits);
+            }
+#endif
+            return (result);
+        }
+#if defined(__SSE2__)
+        static __m128i load(const Plane &plane, std::size_t word)
+        {
+            return (_mm_load_si128(reinterpret_cast<const __m128i *>(plane._words.data() + word)));
+        }
+        static void store(Plane &plane, std::size_t word, __m128i value)
+        {
+            _mm_store_si128(reinterpret_cast<__m128i *>(plane._words.data() + word), value);
+        }
+#endif
+
+        /**
+         * @brief Bits of the tiles, the bits past BOARD_TILES stay clear
+         *
+         */
+        alignas(16) std::array<std::uint64_t, BOARD_WORDS> _words;
+    };
+} // namespace indie::board
+
+#endif /* !BITBOARD_HPP_ */
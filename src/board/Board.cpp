@@ -0,0 +1,187 @@
+/**
+ * @file Board.cpp
+ * @brief Bitboard view of the arena source file
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "Board.hpp"
+#include <algorithm>
+#include <cmath>
+#include "../ecs/system/Explodable/DetonationResolver.hpp"
+
+static_assert(BOARD_COLUMNS == BLAST_GRID_COLUMNS && BOARD_ROWS == BLAST_GRID_ROWS,
+    "The board and the blast grid must share their tiles");
+
+indie::board::Board::Board() : _maxReach(0)
+{
+}
+
+indie::board::Board::~Board()
+{
+}
+
+int indie::board::Board::getTile(float x, float y)
+{
+    return (indie::ecs::system::DetonationResolver::getTile(x, y));
+}
+
+float indie::board::Board::getTileX(int tile)
+{
+    return (BLAST_GRID_LEFT + BLAST_TILE_SIZE * static_cast<float>(tile % BOARD_COLUMNS));
+}
+
+float indie::board::Board::getTileY(int tile)
+{
+    return (BLAST_GRID_TOP - BLAST_TILE_SIZE * static_cast<float>(tile / BOARD_COLUMNS));
+}
+
+void indie::board::Board::sync(
+    std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities, const FlameField *flames)
+{
+    std::array<Plane, BOARD_MAX_REACH + 1> litByReach;
+    int maxLit = 0;
+
+    this->_walls.clear();
+    this->_boxes.clear();
+    this->_bombs.clear();
+    this->_players.clear();
+    std::fill(this->_playerTiles.begin(), this->_playerTiles.end(), -1);
+    for (auto &bombs : this->_bombsByReach)
+        bombs.clear();
+    this->_maxReach = 0;
+    for (auto &entity : entities) {
+        if (entity->hasCompoType(indie::ecs::component::COLLECTABLE))
+            continue;
+        auto transform = entity->getComponent<indie::ecs::component::Transform>(indie::ecs::component::TRANSFORM);
+        if (transform == nullptr)
+            continue;
+        int tile = getTile(transform->getX(), transform->getY());
+        if (tile < 0)
+            continue;
+        indie::ecs::entity::entityType type = entity->getEntityType();
+        if (type == indie::ecs::entity::PLAYER) {
+            auto control =
+                entity->getComponent<indie::ecs::component::PlayerControl>(indie::ecs::component::PLAYERCONTROL);
+            if (control == nullptr || control->getPlayer() < 0
+                || (entity->hasCompoType(indie::ecs::component::ALIVE)
+                    && !entity->getComponent<indie::ecs::component::Alive>(indie::ecs::component::ALIVE)->getAlive()))
+                continue;
+            if (control->getPlayer() >= static_cast<int>(this->_playerTiles.size()))
+                this->_playerTiles.resize(control->getPlayer() + 1, -1);
+            this->_playerTiles[control->getPlayer()] = tile;
+            this->_players.set(tile);
+        } else if (entity->hasCompoType(indie::ecs::component::EXPLODABLE)) {
+            auto bomb = entity->getComponent<indie::ecs::component::Explodable>(indie::ecs::component::EXPLODABLE);
+            if (bomb->getExploded())
+                continue;
+            int reach = std::clamp(static_cast<int>(std::ceil(bomb->getRange() / BLAST_TILE_SIZE)), 0, BOARD_MAX_REACH);
+            this->_bombs.set(tile);
+            this->_bombsByReach[reach].set(tile);
+            this->_maxReach = std::max(this->_maxReach, reach);
+            if (bomb->getExplode()) {
+                litByReach[reach].set(tile);
+                maxLit = std::max(maxLit, reach);
+            }
+        } else if (entity->hasCompoType(indie::ecs::component::COLLIDE)) {
+            if (entity->hasCompoType(indie::ecs::component::DESTROYABLE))
+                this->_boxes.set(tile);
+            else
+                this->_walls.set(tile);
+        }
+    }
+    this->_flames = spread(litByReach, maxLit);
+    if (flames != nullptr)
+        this->_flames |= flames->getBurning();
+}
+
+indie::board::Plane indie::board::Board::spread(
+    const std::array<Plane, BOARD_MAX_REACH + 1> &byReach, int maxReach) const
+{
+    static Plane (Plane::*const steps[4])() const = {&Plane::east, &Plane::west, &Plane::north, &Plane::south};
+    Plane flames;
+
+    for (int reach = 0; reach <= maxReach; reach++)
+        flames |= byReach[reach];
+    for (auto step : steps) {
+        Plane front;
+        // A bomb of reach r joins with r steps left, the walls stop the rays, the boxes burn and let them through
+        for (int left = maxReach; left > 0; left--) {
+            front = (front | byReach[left]);
+            front = (front.*step)().without(this->_walls);
+            flames |= front;
+        }
+    }
+    return (flames);
+}
+
+indie::board::Plane indie::board::Board::getBlast(const Plane &origins, int reach) const
+{
+    std::array<Plane, BOARD_MAX_REACH + 1> byReach;
+
+    reach = std::clamp(reach, 0, BOARD_MAX_REACH);
+    byReach[reach] = origins;
+    return (spread(byReach, reach));
+}
+
+indie::board::Plane indie::board::Board::getDanger() const
+{
+    return (spread(this->_bombsByReach, this->_maxReach));
+}
+
+indie::board::Plane indie::board::Board::getFree() const
+{
+    return (Plane::arena().without(this->_walls | this->_boxes | this->_bombs));
+}
+
+indie::board::Plane indie::board::Board::getReachable(int tile) const
+{
+    Plane free = getFree();
+    Plane reached;
+
+    if (tile < 0 || tile >= BOARD_TILES)
+        return (reached);
+    reached.set(tile);
+    while (true) {
+        Plane next = reached | (reached.adjacent() & free);
+        if (next == reached)
+            break;
+        reached = next;
+    }
+    return (reached);
+}
+
+const indie::board::Plane &indie::board::Board::getWalls() const
+{
+    return (this->_walls);
+}
+
+const indie::board::Plane &indie::board::Board::getBoxes() const
+{
+    return (this->_boxes);
+}
+
+const indie::board::Plane &indie::board::Board::getBombs() const
+{
+    return (this->_bombs);
+}
+
+const indie::board::Plane &indie::board::Board::getFlames() const
+{
+    return (this->_flames);
+}
+
+int indie::board::Board::getPlayerTile(int player) const
+{
+    if (player < 0 || player >= static_cast<int>(this->_playerTiles.size()))
+        return (-1);
+    return (this->_playerTiles[player]);
+}
+
+const indie::board::Plane &indie::board::Board::getPlayers() const
+{
+    return (this->_players);
+}
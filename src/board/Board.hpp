@@ -0,0 +1,196 @@
+/**
+ * @file Board.hpp
+ * @brief Bitboard view of the arena header file
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef BOARD_HPP_
+#define BOARD_HPP_
+
+#include <array>
+#include <memory>
+#include <vector>
+#include "../ecs/entity/Entity.hpp"
+#include "Bitboard.hpp"
+#include "FlameField.hpp"
+
+/// @brief Longest blast ray, in tiles
+#define BOARD_MAX_REACH (BOARD_COLUMNS - 1)
+
+namespace indie::board
+{
+    /**
+     * @brief The arena as bit planes: walls, boxes, bombs, flames and players
+     *
+     * The planes are rebuilt from the entities once per tick, then the blast, danger and reachability queries are a
+     * few dozen plane shifts instead of walks over the entities.
+     */
+    class Board {
+      public:
+        /**
+         * @brief Construct a new empty Board object
+         *
+         */
+        Board();
+        /**
+         * @brief Destroy the Board object
+         *
+         */
+        ~Board();
+        /**
+         * @brief Rebuild the planes from the entities
+         *
+         * @param entities Entities of the world
+         * @param flames Flames left by the explosions, nullptr to ignore them
+         */
+        void sync(std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities,
+            const FlameField *flames = nullptr);
+        /**
+         * @brief Get the tile under a world position
+         *
+         * @param x World x
+         * @param y World y
+         * @return int Tile index, -1 outside of the arena
+         */
+        static int getTile(float x, float y);
+        /**
+         * @brief Get the world x of the center of a tile
+         *
+         * @param tile Tile index
+         * @return float World x
+         */
+        static float getTileX(int tile);
+        /**
+         * @brief Get the world y of the center of a tile
+         *
+         * @param tile Tile index
+         * @return float World y
+         */
+        static float getTileY(int tile);
+        /**
+         * @brief Get the walls
+         *
+         * @return const Plane& Indestructible tiles
+         */
+        const Plane &getWalls() const;
+        /**
+         * @brief Get the boxes
+         *
+         * @return const Plane& Destructible tiles
+         */
+        const Plane &getBoxes() const;
+        /**
+         * @brief Get the bombs
+         *
+         * @return const Plane& Tiles holding a bomb not exploded yet
+         */
+        const Plane &getBombs() const;
+        /**
+         * @brief Get the flames
+         *
+         * @return const Plane& Tiles still burning and tiles burnt by the bombs exploding at the next tick
+         */
+        const Plane &getFlames() const;
+        /**
+         * @brief Get the tile of a player
+         *
+         * @param player Player index
+         * @return int Tile of the player, -1 when dead or absent
+         */
+        int getPlayerTile(int player) const;
+        /**
+         * @brief Get the tiles of the living players
+         *
+         * @return const Plane& One bit per occupied tile, whatever the number of players
+         */
+        const Plane &getPlayers() const;
+        /**
+         * @brief Get the tiles a player can walk on
+         *
+         * @return Plane Arena without the walls, the boxes and the bombs
+         */
+        Plane getFree() const;
+        /**
+         * @brief Get the tiles burnt by bombs
+         *
+         * @param origins Tiles of the bombs
+         * @param reach Length of their rays, in tiles
+         * @return Plane Flame tiles
+         */
+        Plane getBlast(const Plane &origins, int reach) const;
+        /**
+         * @brief Get the tiles every bomb on the board will burn, chain reactions excluded
+         *
+         * @return Plane Dangerous tiles
+         */
+        Plane getDanger() const;
+        /**
+         * @brief Get the tiles reachable by walking from a tile
+         *
+         * @param tile Starting tile, it is reachable even if it holds a bomb
+         * @return Plane Reachable tiles
+         */
+        Plane getReachable(int tile) const;
+
+      protected:
+      private:
+        /**
+         * @brief Cast the rays of bombs grouped by reach
+         *
+         * Every ray moves one tile per step, the bombs join in when the steps left match their reach, so the cost
+         * depends on the longest reach and not on the number of bombs.
+         *
+         * @param byReach Bomb tiles, by reach
+         * @param maxReach Longest reach in byReach
+         * @return Plane Flame tiles
+         */
+        Plane spread(const std::array<Plane, BOARD_MAX_REACH + 1> &byReach, int maxReach) const;
+
+        /**
+         * @brief Indestructible tiles
+         *
+         */
+        Plane _walls;
+        /**
+         * @brief Destructible tiles
+         *
+         */
+        Plane _boxes;
+        /**
+         * @brief Bomb tiles
+         *
+         */
+        Plane _bombs;
+        /**
+         * @brief Flame tiles
+         *
+         */
+        Plane _flames;
+        /**
+         * @brief Tile of each player, by player index
+         *
+         */
+        std::vector<int> _playerTiles;
+        /**
+         * @brief Tiles of the living players
+         *
+         */
+        Plane _players;
+        /**
+         * @brief Bomb tiles by reach
+         *
+         */
+        std::array<Plane, BOARD_MAX_REACH + 1> _bombsByReach;
+        /**
+         * @brief Longest reach of the bombs
+         *
+         */
+        int _maxReach;
+    };
+} // namespace indie::board
+
+#endif /* !BOARD_HPP_ */
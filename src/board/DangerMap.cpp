@@ -0,0 +1,197 @@
+/**
+ * @file DangerMap.cpp
+ * @brief Earliest detonation tick of each tile source file
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "DangerMap.hpp"
+#include <algorithm>
+#include "../tools/FrameArena.hpp"
+
+namespace
+{
+    /// @brief Remove the first occurrence of an id
+    void eraseId(std::vector<std::uint32_t> &ids, std::uint32_t id)
+    {
+        auto it = std::find(ids.begin(), ids.end(), id);
+
+        if (it != ids.end()) {
+            *it = ids.back();
+            ids.pop_back();
+        }
+    }
+} // namespace
+
+indie::board::DangerMap::DangerMap()
+{
+    this->_earliest.fill(SAFE);
+}
+
+indie::board::DangerMap::~DangerMap()
+{
+}
+
+void indie::board::DangerMap::castRays(Bomb &bomb) const
+{
+    static const int steps[4][2] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
+    int column = bomb.tile % BOARD_COLUMNS;
+    int row = bomb.tile / BOARD_COLUMNS;
+
+    bomb.tiles.clear();
+    bomb.tiles.push_back(bomb.tile);
+    for (auto &step : steps) {
+        for (int distance = 1; distance <= bomb.reach; distance++) {
+            int x = column + step[0] * distance;
+            int y = row + step[1] * distance;
+            if (x < 0 || x >= BOARD_COLUMNS || y < 0 || y >= BOARD_ROWS || this->_walls.test(y * BOARD_COLUMNS + x))
+                break;
+            bomb.tiles.push_back(y * BOARD_COLUMNS + x);
+        }
+    }
+}
+
+void indie::board::DangerMap::lower(int tile, std::uint64_t tick)
+{
+    if (tick >= this->_earliest[tile])
+        return;
+    this->_earliest[tile] = tick;
+    this->_danger.set(tile);
+}
+
+void indie::board::DangerMap::chain(std::uint32_t id)
+{
+    this->_queue.clear();
+    this->_queue.push_back(id);
+    for (size_t next = 0; next < this->_queue.size(); next++) {
+        const Bomb &bomb = this->_bombs.at(this->_queue[next]);
+        for (auto tile : bomb.tiles) {
+            for (auto other : this->_located[tile]) {
+                Bomb &chained = this->_bombs.at(other);
+                if (chained.tick <= bomb.tick)
+                    continue;
+                chained.tick = bomb.tick;
+                for (auto covered : chained.tiles)
+                    lower(covered, chained.tick);
+                this->_queue.push_back(other);
+            }
+        }
+    }
+}
+
+void indie::board::DangerMap::addBomb(std::uint32_t id, int tile, int reach, std::uint64_t tick)
+{
+    if (tile < 0 || tile >= BOARD_TILES)
+        return;
+    removeBomb(id);
+    Bomb &bomb = this->_bombs[id];
+    bomb.tile = tile;
+    bomb.reach = reach;
+    bomb.fuseTick = tick;
+    // Dropped in the rays of another bomb, it goes off with it
+    bomb.tick = std::min(tick, this->_earliest[tile]);
+    castRays(bomb);
+    this->_located[tile].push_back(id);
+    for (auto covered : bomb.tiles) {
+        this->_coverers[covered].push_back(id);
+        lower(covered, bomb.tick);
+    }
+    chain(id);
+}
+
+void indie::board::DangerMap::removeBomb(std::uint32_t id)
+{
+    removeBombs(std::span<const std::uint32_t>(&id, 1));
+}
+
+void indie::board::DangerMap::removeBombs(std::span<const std::uint32_t> ids)
+{
+    indie::tools::FrameVector<int> tiles;
+
+    for (auto id : ids) {
+        auto it = this->_bombs.find(id);
+        if (it == this->_bombs.end())
+            continue;
+        eraseId(this->_located[it->second.tile], id);
+        for (auto tile : it->second.tiles) {
+            eraseId(this->_coverers[tile], id);
+            tiles.push_back(tile);
+        }
+        this->_bombs.erase(it);
+    }
+    // Bombs chained by the removed ones usually explode with them, otherwise their chains are recomputed
+    for (auto &bomb : this->_bombs) {
+        if (bomb.second.tick < bomb.second.fuseTick) {
+            rebuild();
+            return;
+        }
+    }
+    for (auto tile : tiles)
+        refresh(tile);
+}
+
+void indie::board::DangerMap::refresh(int tile)
+{
+    std::uint64_t earliest = SAFE;
+
+    for (auto id : this->_coverers[tile])
+        earliest = std::min(earliest, this->_bombs.at(id).tick);
+    this->_earliest[tile] = earliest;
+    if (earliest == SAFE)
+        this->_danger.reset(tile);
+    else
+        this->_danger.set(tile);
+}
+
+void indie::board::DangerMap::rebuild()
+{
+    this->_earliest.fill(SAFE);
+    this->_danger.clear();
+    for (auto &tile : this->_coverers)
+        tile.clear();
+    for (auto &bomb : this->_bombs) {
+        bomb.second.tick = bomb.second.fuseTick;
+        castRays(bomb.second);
+        for (auto covered : bomb.second.tiles)
+            this->_coverers[covered].push_back(bomb.first);
+    }
+    for (auto &bomb : this->_bombs)
+        for (auto covered : bomb.second.tiles)
+            lower(covered, bomb.second.tick);
+    for (auto &bomb : this->_bombs)
+        chain(bomb.first);
+}
+
+void indie::board::DangerMap::setWalls(const Plane &walls)
+{
+    if (walls == this->_walls)
+        return;
+    this->_walls = walls;
+    rebuild();
+}
+
+void indie::board::DangerMap::clear()
+{
+    this->_bombs.clear();
+    for (auto &tile : this->_coverers)
+        tile.clear();
+    for (auto &tile : this->_located)
+        tile.clear();
+    this->_earliest.fill(SAFE);
+    this->_danger.clear();
+}
+
+std::uint64_t indie::board::DangerMap::getEarliest(int tile) const
+{
+    if (tile < 0 || tile >= BOARD_TILES)
+        return (SAFE);
+    return (this->_earliest[tile]);
+}
+
+const indie::board::Plane &indie::board::DangerMap::getDanger() const
+{
+    return (this->_danger);
+}
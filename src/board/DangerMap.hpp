@@ -0,0 +1,177 @@
+/**
+ * @file DangerMap.hpp
+ * @brief Earliest detonation tick of each tile header file
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef DANGERMAP_HPP_
+#define DANGERMAP_HPP_
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <unordered_map>
+#include <vector>
+#include "Bitboard.hpp"
+
+namespace indie::board
+{
+    /**
+     * @brief Earliest tick at which a blast reaches each tile, kept up to date from the bomb events
+     *
+     * Each armed bomb remembers the tiles of its rays and each tile the bombs covering it, so placing a bomb only
+     * touches its own rays and the bombs it chains, and removing one only recomputes the tiles it covered. A bomb in
+     * the rays of another one takes the earlier tick, as it will go off with it.
+     */
+    class DangerMap {
+      public:
+        /// @brief Tick of a tile no bomb reaches
+        static constexpr std::uint64_t SAFE = std::numeric_limits<std::uint64_t>::max();
+
+        /**
+         * @brief Construct a new DangerMap object without bombs
+         *
+         */
+        DangerMap();
+        /**
+         * @brief Destroy the DangerMap object
+         *
+         */
+        ~DangerMap();
+        /**
+         * @brief Set the tiles stopping the rays, the rays are only recomputed when they change
+         *
+         * @param walls Indestructible tiles
+         */
+        void setWalls(const Plane &walls);
+        /**
+         * @brief Add an armed bomb
+         *
+         * @param id Unique id of the bomb
+         * @param tile Tile of the bomb
+         * @param reach Length of its rays, in tiles
+         * @param tick Tick it explodes at
+         */
+        void addBomb(std::uint32_t id, int tile, int reach, std::uint64_t tick);
+        /**
+         * @brief Remove a bomb that exploded or was disarmed
+         *
+         * @param id Id given to addBomb, unknown ids are ignored
+         */
+        void removeBomb(std::uint32_t id);
+        /**
+         * @brief Remove bombs exploding together
+         *
+         * @param ids Ids given to addBomb, unknown ids are ignored
+         */
+        void removeBombs(std::span<const std::uint32_t> ids);
+        /**
+         * @brief Remove every bomb
+         *
+         */
+        void clear();
+        /**
+         * @brief Get the earliest tick a blast reaches a tile
+         *
+         * @param tile Tile index
+         * @return std::uint64_t Tick, SAFE when no bomb reaches the tile
+         */
+        std::uint64_t getEarliest(int tile) const;
+        /**
+         * @brief Get the tiles a bomb will reach
+         *
+         * @return const Plane& Tiles with a detonation tick
+         */
+        const Plane &getDanger() const;
+
+      protected:
+      private:
+        /// @brief An armed bomb
+        struct Bomb {
+            /// @brief Tile of the bomb
+            int tile;
+            /// @brief Length of its rays
+            int reach;
+            /// @brief Tick its own fuse ends
+            std::uint64_t fuseTick;
+            /// @brief Tick it explodes, earlier than fuseTick when another bomb chains it
+            std::uint64_t tick;
+            /// @brief Tiles of its rays, its own tile first
+            std::vector<int> tiles;
+        };
+
+        /**
+         * @brief Compute the tiles of the rays of a bomb
+         *
+         * @param bomb The bomb
+         */
+        void castRays(Bomb &bomb) const;
+        /**
+         * @brief Lower the tick of a tile
+         *
+         * @param tile Tile index
+         * @param tick Candidate tick
+         */
+        void lower(int tile, std::uint64_t tick);
+        /**
+         * @brief Give the tick of a bomb to the later bombs in its rays, and theirs to the next ones
+         *
+         * @param id Id of the bomb
+         */
+        void chain(std::uint32_t id);
+        /**
+         * @brief Recompute a tile from the bombs still covering it
+         *
+         * @param tile Tile index
+         */
+        void refresh(int tile);
+        /**
+         * @brief Recompute every tile and every chain, when a removal may break a chain
+         *
+         */
+        void rebuild();
+
+        /**
+         * @brief Tiles stopping the rays
+         *
+         */
+        Plane _walls;
+        /**
+         * @brief Armed bombs by id
+         *
+         */
+        std::unordered_map<std::uint32_t, Bomb> _bombs;
+        /**
+         * @brief Bombs whose rays cover each tile
+         *
+         */
+        std::array<std::vector<std::uint32_t>, BOARD_TILES> _coverers;
+        /**
+         * @brief Bombs lying on each tile
+         *
+         */
+        std::array<std::vector<std::uint32_t>, BOARD_TILES> _located;
+        /**
+         * @brief Earliest tick of each tile
+         *
+         */
+        std::array<std::uint64_t, BOARD_TILES> _earliest;
+        /**
+         * @brief Tiles with a tick
+         *
+         */
+        Plane _danger;
+        /**
+         * @brief Bombs waiting to pass their tick on
+         *
+         */
+        std::vector<std::uint32_t> _queue;
+    };
+} // namespace indie::board
+
+#endif /* !DANGERMAP_HPP_ */
@@ -0,0 +1,109 @@
+/**
+ * @file FlameField.cpp
+ * @brief Per tile flame lifetimes source file
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "FlameField.hpp"
+#include <algorithm>
+
+indie::board::FlameField::FlameField() : _lifetime{}, _active(false)
+{
+}
+
+indie::board::FlameField::~FlameField()
+{
+}
+
+void indie::board::FlameField::tick()
+{
+    if (!this->_active)
+        return;
+#if defined(__SSE2__)
+    const __m128i one = _mm_set1_epi8(1);
+    __m128i alive = _mm_setzero_si128();
+
+    for (std::size_t byte = 0; byte < this->_lifetime.size(); byte += 16) {
+        __m128i *lane = reinterpret_cast<__m128i *>(this->_lifetime.data() + byte);
+        __m128i aged = _mm_subs_epu8(_mm_load_si128(lane), one);
+
+        _mm_store_si128(lane, aged);
+        alive = _mm_or_si128(alive, aged);
+    }
+    this->_active = _mm_movemask_epi8(_mm_cmpeq_epi8(alive, _mm_setzero_si128())) != 0xFFFF;
+#else
+    std::uint8_t alive = 0;
+
+    for (auto &lifetime : this->_lifetime) {
+        lifetime -= lifetime != 0;
+        alive |= lifetime;
+    }
+    this->_active = alive != 0;
+#endif
+}
+
+void indie::board::FlameField::ignite(int tile, std::uint8_t ticks)
+{
+    if (tile < 0 || tile >= BOARD_TILES)
+        return;
+    this->_lifetime[tile] = std::max(this->_lifetime[tile], ticks);
+    this->_active = this->_active || ticks != 0;
+}
+
+void indie::board::FlameField::ignite(const std::vector<int> &tiles, std::uint8_t ticks)
+{
+    for (auto tile : tiles)
+        ignite(tile, ticks);
+}
+
+void indie::board::FlameField::clear()
+{
+    this->_lifetime.fill(0);
+    this->_active = false;
+}
+
+bool indie::board::FlameField::isBurning(int tile) const
+{
+    return (tile >= 0 && tile < BOARD_TILES && this->_lifetime[tile] != 0);
+}
+
+std::uint8_t indie::board::FlameField::getLifetime(int tile) const
+{
+    if (tile < 0 || tile >= BOARD_TILES)
+        return (0);
+    return (this->_lifetime[tile]);
+}
+
+bool indie::board::FlameField::isActive() const
+{
+    return (this->_active);
+}
+
+indie::board::Plane indie::board::FlameField::getBurning() const
+{
+    Plane burning;
+
+    if (!this->_active)
+        return (burning);
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+
+    // 16 tiles per lane: the compare gives one byte per tile, the movemask packs them in 16 bits
+    for (std::size_t byte = 0; byte < this->_lifetime.size(); byte += 16) {
+        __m128i lane = _mm_load_si128(reinterpret_cast<const __m128i *>(this->_lifetime.data() + byte));
+        int mask = ~_mm_movemask_epi8(_mm_cmpeq_epi8(lane, zero)) & 0xFFFF;
+
+        for (; mask != 0; mask &= mask - 1)
+            burning.set(static_cast<int>(byte) + std::countr_zero(static_cast<unsigned int>(mask)));
+    }
+#else
+    for (int tile = 0; tile < BOARD_TILES; tile++)
+        if (this->_lifetime[tile] != 0)
+            burning.set(tile);
+#endif
+    return (burning);
+}
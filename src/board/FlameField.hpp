@@ -0,0 +1,108 @@
+/**
+ * @file FlameField.hpp
+ * @brief Per tile flame lifetimes header file
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef FLAMEFIELD_HPP_
+#define FLAMEFIELD_HPP_
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "Bitboard.hpp"
+
+/// @brief Ticks a flame keeps burning after its explosion
+#define FLAME_TICKS 30
+
+namespace indie::board
+{
+    /**
+     * @brief Remaining lifetime of the flames of each tile, one byte per tile
+     *
+     * The whole grid ages in one saturating subtraction per 16 tiles with SSE2, and a tile is sampled with a single
+     * load, so the explosions leave flames behind without any entity.
+     */
+    class FlameField {
+      public:
+        /**
+         * @brief Construct a new FlameField object without flames
+         *
+         */
+        FlameField();
+        /**
+         * @brief Destroy the FlameField object
+         *
+         */
+        ~FlameField();
+        /**
+         * @brief Age every flame by one tick
+         *
+         */
+        void tick();
+        /**
+         * @brief Set a tile on fire, an older flame is renewed
+         *
+         * @param tile Tile index
+         * @param ticks Lifetime of the flame
+         */
+        void ignite(int tile, std::uint8_t ticks = FLAME_TICKS);
+        /**
+         * @brief Set tiles on fire
+         *
+         * @param tiles Tile indexes
+         * @param ticks Lifetime of the flames
+         */
+        void ignite(const std::vector<int> &tiles, std::uint8_t ticks = FLAME_TICKS);
+        /**
+         * @brief Put out every flame
+         *
+         */
+        void clear();
+        /**
+         * @brief Tell if a tile burns
+         *
+         * @param tile Tile index, -1 is never burning
+         * @return true If the tile has a live flame
+         */
+        bool isBurning(int tile) const;
+        /**
+         * @brief Get the remaining lifetime of a tile
+         *
+         * @param tile Tile index
+         * @return std::uint8_t Ticks left, 0 when the tile does not burn
+         */
+        std::uint8_t getLifetime(int tile) const;
+        /**
+         * @brief Tell if any tile burns
+         *
+         * @return true If at least one flame is alive
+         */
+        bool isActive() const;
+        /**
+         * @brief Get the burning tiles as a plane
+         *
+         * @return Plane Tiles with a live flame
+         */
+        Plane getBurning() const;
+
+      protected:
+      private:
+        /**
+         * @brief Lifetime of each tile, padded to a whole plane
+         *
+         */
+        alignas(16) std::array<std::uint8_t, BOARD_WORDS * 64> _lifetime;
+        /**
+         * @brief Whether a flame may be alive, it spares ageing an empty field
+         *
+         */
+        bool _active;
+    };
+} // namespace indie::board
+
+#endif /* !FLAMEFIELD_HPP_ */
@@ -0,0 +1,160 @@
+/**
+ * @file AssetLoader.cpp
+ * @brief Asset decoding on the job system source file
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "AssetLoader.hpp"
+#include <filesystem>
+#include "../profiling/Counters.hpp"
+#include "../profiling/Trace.hpp"
+#include "../raylib/sound/Sound.hpp"
+#include "../raylib/texture2d/Texture2D.hpp"
+
+indie::core::AssetLoader *indie::core::AssetLoader::_active = nullptr;
+
+namespace
+{
+    /**
+     * @brief Key of a file, the same for every spelling of its path
+     *
+     * @param path Path of the file
+     * @return std::string The path without its ./ and .. parts
+     */
+    std::string key(const std::string &path)
+    {
+        return (std::filesystem::path(path).lexically_normal().generic_string());
+    }
+} // namespace
+
+indie::core::AssetLoader::AssetLoader(indie::core::JobSystem &jobs) : _jobs(jobs), _queued(0), _decoded(0)
+{
+    _active = this;
+}
+
+indie::core::AssetLoader::~AssetLoader()
+{
+    release();
+    if (_active == this)
+        _active = nullptr;
+}
+
+void indie::core::AssetLoader::preloadImage(const std::string &path)
+{
+    auto [it, inserted] = this->_images.try_emplace(key(path));
+    PendingImage *pending = &it->second;
+
+    if (!inserted)
+        return;
+    pending->image = {};
+    this->_queued++;
+    // The map nodes do not move, the job writes its own entry only
+    pending->decoding = this->_jobs.submit([this, pending, path]() {
+        TRACE_ZONE("AssetLoader::decodeImage");
+        pending->image = indie::raylib::Texture2D::loadImage(path);
+        this->_decoded.fetch_add(1, std::memory_order_release);
+    });
+}
+
+std::size_t indie::core::AssetLoader::preloadImages(const std::string &directory, const std::string &extension)
+{
+    std::error_code error;
+    std::size_t count = 0;
+
+    for (auto &entry : std::filesystem::directory_iterator(directory, error)) {
+        if (!entry.is_regular_file() || entry.path().extension() != extension)
+            continue;
+        preloadImage(entry.path().generic_string());
+        count++;
+    }
+    return (count);
+}
+
+void indie::core::AssetLoader::preloadWave(const std::string &path)
+{
+    auto [it, inserted] = this->_waves.try_emplace(key(path));
+    PendingWave *pending = &it->second;
+
+    if (!inserted)
+        return;
+    pending->wave = {};
+    this->_queued++;
+    pending->decoding = this->_jobs.submit([this, pending, path]() {
+        TRACE_ZONE("AssetLoader::decodeWave");
+        pending->wave = indie::raylib::Sound::loadWave(path);
+        this->_decoded.fetch_add(1, std::memory_order_release);
+    });
+}
+
+float indie::core::AssetLoader::getProgress() const
+{
+    if (this->_queued == 0)
+        return (1.0f);
+    return (static_cast<float>(this->_decoded.load(std::memory_order_acquire)) / static_cast<float>(this->_queued));
+}
+
+bool indie::core::AssetLoader::isDecoded() const
+{
+    return (this->_decoded.load(std::memory_order_acquire) >= this->_queued);
+}
+
+const ::Image *indie::core::AssetLoader::getImage(const std::string &path)
+{
+    auto it = this->_images.find(key(path));
+
+    if (it == this->_images.end())
+        return (nullptr);
+    this->_jobs.wait(it->second.decoding);
+    return (it->second.image.data != nullptr ? &it->second.image : nullptr);
+}
+
+const ::Wave *indie::core::AssetLoader::getWave(const std::string &path)
+{
+    auto it = this->_waves.find(key(path));
+
+    if (it == this->_waves.end())
+        return (nullptr);
+    this->_jobs.wait(it->second.decoding);
+    return (it->second.wave.data != nullptr ? &it->second.wave : nullptr);
+}
+
+void indie::core::AssetLoader::release()
+{
+    for (auto &[path, pending] : this->_images) {
+        this->_jobs.wait(pending.decoding);
+        if (pending.image.data != nullptr)
+            indie::raylib::Texture2D::unloadImage(pending.image);
+    }
+    for (auto &[path, pending] : this->_waves) {
+        this->_jobs.wait(pending.decoding);
+        if (pending.wave.data != nullptr)
+            indie::raylib::Sound::unloadWave(pending.wave);
+    }
+    this->_images.clear();
+    this->_waves.clear();
+    this->_queued = 0;
+    this->_decoded.store(0, std::memory_order_relaxed);
+}
+
+::Texture2D indie::core::AssetLoader::loadTexture(const std::string &path, const std::source_location &site)
+{
+    const ::Image *image = nullptr;
+
+    // The upload is a GL call, a worker hands the whole load over to the main thread and waits for it
+    if (_active != nullptr && !_active->_jobs.isMainThread()) {
+        ::Texture2D texture = {};
+        indie::core::JobSystem &jobs = _active->_jobs;
+        jobs.wait(jobs.submitMain([&texture, &path, &site]() { texture = loadTexture(path, site); }));
+        return (texture);
+    }
+    if (_active != nullptr)
+        image = _active->getImage(path);
+    if (image == nullptr)
+        return (indie::raylib::Texture2D::load(path.c_str(), site));
+    COUNTER_INC(TEXTURE_LOADS);
+    return (indie::raylib::Texture2D::loadFromImage(*image, site));
+}
@@ -0,0 +1,144 @@
+/**
+ * @file AssetLoader.hpp
+ * @brief Asset decoding on the job system header file
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef ASSETLOADER_HPP_
+#define ASSETLOADER_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <source_location>
+#include <string>
+#include "../raylib/Raylib.hpp"
+#include "JobSystem.hpp"
+
+namespace indie::core
+{
+    /**
+     * @brief Decodes the startup assets on the workers, leaving only their upload to the main thread
+     *
+     * A preloaded file is decoded by a job as soon as it is queued. Asking for it afterwards waits for that file
+     * only, running other jobs meanwhile, then uploads the decoded copy; a file that was not preloaded is loaded the
+     * usual way. The components load their textures through the loader alive, so the screens built during the
+     * startup use the decoded files without knowing about them.
+     *
+     * Everything but the decoding runs on the main thread, the thread that created the job system.
+     */
+    class AssetLoader {
+      public:
+        /**
+         * @brief Construct a new AssetLoader object, the one the components load through while it lives
+         *
+         * @param jobs Job system decoding the files
+         */
+        explicit AssetLoader(indie::core::JobSystem &jobs);
+        /**
+         * @brief Destroy the AssetLoader object, releasing what is still decoded
+         *
+         */
+        ~AssetLoader();
+        AssetLoader(const AssetLoader &) = delete;
+        AssetLoader &operator=(const AssetLoader &) = delete;
+
+        /**
+         * @brief Start decoding an image file
+         *
+         * @param path Path of the image
+         */
+        void preloadImage(const std::string &path);
+        /**
+         * @brief Start decoding every image of a directory, its subdirectories excepted
+         *
+         * @param directory Path of the directory
+         * @param extension Extension of the images, with its dot
+         * @return std::size_t Number of images queued
+         */
+        std::size_t preloadImages(const std::string &directory, const std::string &extension = ".png");
+        /**
+         * @brief Start decoding a sound file
+         *
+         * @param path Path of the sound
+         */
+        void preloadWave(const std::string &path);
+        /**
+         * @brief Get the share of the preloaded files decoded already
+         *
+         * @return float From 0 to 1, 1 when nothing is preloaded
+         */
+        float getProgress() const;
+        /**
+         * @brief Check if every preloaded file is decoded
+         *
+         * @return true If nothing is left to decode
+         */
+        bool isDecoded() const;
+        /**
+         * @brief Get a preloaded image, waiting for its decoding
+         *
+         * @param path Path of the image
+         * @return const ::Image* The decoded pixels, nullptr if the image was not preloaded or could not be decoded
+         */
+        const ::Image *getImage(const std::string &path);
+        /**
+         * @brief Get a preloaded sound, waiting for its decoding
+         *
+         * @param path Path of the sound
+         * @return const ::Wave* The decoded samples, nullptr if the sound was not preloaded or could not be decoded
+         */
+        const ::Wave *getWave(const std::string &path);
+        /**
+         * @brief Wait for the decodings left, then free every decoded file, the later loads read their files again
+         *
+         */
+        void release();
+        /**
+         * @brief Load a texture, from the decoded copy of the loader alive when there is one
+         *
+         * Called from a worker, it queues the load for the main thread and waits for it, running other jobs meanwhile.
+         *
+         * @param path Path of the image
+         * @param site Code loading it, for the resource accounting
+         * @return ::Texture2D The texture
+         */
+        static ::Texture2D loadTexture(
+            const std::string &path, const std::source_location &site = std::source_location::current());
+
+      private:
+        /// @brief Image being decoded or decoded
+        struct PendingImage {
+            /// @brief Decoding job
+            indie::core::JobSystem::Handle decoding;
+            /// @brief Decoded pixels, written by the job
+            ::Image image;
+        };
+        /// @brief Sound being decoded or decoded
+        struct PendingWave {
+            /// @brief Decoding job
+            indie::core::JobSystem::Handle decoding;
+            /// @brief Decoded samples, written by the job
+            ::Wave wave;
+        };
+
+        /// @brief Job system decoding the files
+        indie::core::JobSystem &_jobs;
+        /// @brief Images, by path
+        std::map<std::string, PendingImage> _images;
+        /// @brief Sounds, by path
+        std::map<std::string, PendingWave> _waves;
+        /// @brief Files queued
+        std::size_t _queued;
+        /// @brief Files decoded, counted by the jobs
+        std::atomic<std::size_t> _decoded;
+        /// @brief Loader the components load through, nullptr when there is none
+        static AssetLoader *_active;
+    };
+} // namespace indie::core
+
+#endif /* !ASSETLOADER_HPP_ */
@@ -0,0 +1,253 @@
+/**
+ * @file JobSystem.cpp
+ * @brief Work stealing job system source file
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "JobSystem.hpp"
+#include <algorithm>
+#include <string>
+#include "../profiling/Trace.hpp"
+#include "../tools/FrameArena.hpp"
+
+thread_local indie::core::JobSystem *indie::core::JobSystem::_owner = nullptr;
+thread_local std::size_t indie::core::JobSystem::_index = 0;
+
+bool indie::core::JobSystem::Handle::isDone() const
+{
+    return (this->_job == nullptr || this->_job->done.load(std::memory_order_acquire));
+}
+
+indie::core::JobSystem::JobSystem(std::size_t workers)
+    : _queued(0), _next(0), _stopping(false), _mainThread(std::this_thread::get_id())
+{
+    if (workers == 0) {
+        unsigned int cores = std::thread::hardware_concurrency();
+        workers = cores > 1 ? cores - 1 : 1;
+    }
+    for (std::size_t index = 0; index < workers; index++)
+        this->_workers.push_back(std::make_unique<Worker>());
+    // Started once every deque exists, a worker steals from all of them
+    for (std::size_t index = 0; index < workers; index++)
+        this->_workers[index]->thread = std::thread(&indie::core::JobSystem::work, this, index);
+}
+
+indie::core::JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard<std::mutex> guard(this->_sleepLock);
+        this->_stopping = true;
+    }
+    this->_wake.notify_all();
+    for (auto &worker : this->_workers)
+        if (worker->thread.joinable())
+            worker->thread.join();
+}
+
+indie::core::JobSystem::Handle indie::core::JobSystem::submit(
+    std::function<void()> work, std::span<const Handle> dependencies)
+{
+    return (create(std::move(work), dependencies, false));
+}
+
+indie::core::JobSystem::Handle indie::core::JobSystem::submitMain(
+    std::function<void()> work, std::span<const Handle> dependencies)
+{
+    return (create(std::move(work), dependencies, true));
+}
+
+void indie::core::JobSystem::wait(const Handle &handle)
+{
+    bool mainThread = isMainThread();
+
+    while (!handle.isDone()) {
+        std::shared_ptr<Job> job = take(mainThread);
+        if (job != nullptr)
+            execute(job);
+        else
+            std::this_thread::yield();
+    }
+}
+
+void indie::core::JobSystem::parallelFor(
+    std::size_t count, std::size_t grain, const std::function<void(std::size_t, std::size_t)> &work)
+{
+    std::size_t chunk = std::max<std::size_t>(grain, 1);
+    std::size_t chunks = (count + chunk - 1) / chunk;
+    std::atomic<std::size_t> next(0);
+    auto run = [&]() {
+        for (std::size_t index = next.fetch_add(1); index < chunks; index = next.fetch_add(1))
+            work(index * chunk, std::min(count, (index + 1) * chunk));
+    };
+
+    if (chunks <= 1) {
+        if (count > 0)
+            work(0, count);
+        return;
+    }
+    // The helpers share the chunks with the caller, a slow chunk does not hold the others back
+    std::size_t helperCount = std::min(chunks - 1, this->_workers.size());
+    indie::tools::FrameVector<Handle> helpers;
+    helpers.reserve(helperCount);
+    for (std::size_t index = 0; index < helperCount; index++)
+        helpers.push_back(submit(run));
+    run();
+    for (auto &helper : helpers)
+        wait(helper);
+}
+
+void indie::core::JobSystem::runMainThreadJobs()
+{
+    while (true) {
+        std::shared_ptr<Job> job;
+        {
+            std::lock_guard<std::mutex> guard(this->_mainLock);
+            if (this->_mainJobs.empty())
+                return;
+            job = std::move(this->_mainJobs.front());
+            this->_mainJobs.pop_front();
+        }
+        execute(job);
+    }
+}
+
+std::size_t indie::core::JobSystem::getWorkerCount() const
+{
+    return (this->_workers.size());
+}
+
+bool indie::core::JobSystem::isMainThread() const
+{
+    return (std::this_thread::get_id() == this->_mainThread);
+}
+
+indie::core::JobSystem::Handle indie::core::JobSystem::create(
+    std::function<void()> work, std::span<const Handle> dependencies, bool mainThread)
+{
+    std::shared_ptr<Job> job = std::make_shared<Job>();
+    Handle handle;
+
+    job->work = std::move(work);
+    job->mainThread = mainThread;
+    job->blockers.store(1, std::memory_order_relaxed);
+    job->done.store(false, std::memory_order_relaxed);
+    for (auto &dependency : dependencies) {
+        if (dependency._job == nullptr)
+            continue;
+        std::lock_guard<std::mutex> guard(dependency._job->lock);
+        if (!dependency._job->done.load(std::memory_order_relaxed)) {
+            dependency._job->dependents.push_back(job);
+            job->blockers.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    handle._job = job;
+    // The extra blocker kept a dependency ending meanwhile from queueing the job twice
+    if (job->blockers.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        enqueue(std::move(job));
+    return (handle);
+}
+
+void indie::core::JobSystem::enqueue(std::shared_ptr<Job> job)
+{
+    if (job->mainThread) {
+        std::lock_guard<std::mutex> guard(this->_mainLock);
+        this->_mainJobs.push_back(std::move(job));
+        return;
+    }
+    Worker &worker = _owner == this
+        ? *this->_workers[_index]
+        : *this->_workers[this->_next.fetch_add(1, std::memory_order_relaxed) % this->_workers.size()];
+    // Counted first, so the count never drops below the jobs really queued
+    this->_queued.fetch_add(1, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> guard(worker.lock);
+        worker.jobs.push_back(std::move(job));
+    }
+    {
+        std::lock_guard<std::mutex> guard(this->_sleepLock);
+    }
+    this->_wake.notify_one();
+}
+
+std::shared_ptr<indie::core::JobSystem::Job> indie::core::JobSystem::take(bool mainThread)
+{
+    std::shared_ptr<Job> job;
+    std::size_t first = 0;
+
+    if (mainThread) {
+        std::lock_guard<std::mutex> guard(this->_mainLock);
+        if (!this->_mainJobs.empty()) {
+            job = std::move(this->_mainJobs.front());
+            this->_mainJobs.pop_front();
+            return (job);
+        }
+    }
+    if (_owner == this) {
+        Worker &own = *this->_workers[_index];
+        std::lock_guard<std::mutex> guard(own.lock);
+        if (!own.jobs.empty()) {
+            job = std::move(own.jobs.back());
+            own.jobs.pop_back();
+            this->_queued.fetch_sub(1, std::memory_order_relaxed);
+            return (job);
+        }
+        first = _index + 1;
+    }
+    for (std::size_t offset = 0; offset < this->_workers.size(); offset++) {
+        Worker &victim = *this->_workers[(first + offset) % this->_workers.size()];
+        std::lock_guard<std::mutex> guard(victim.lock);
+        if (!victim.jobs.empty()) {
+            job = std::move(victim.jobs.front());
+            victim.jobs.pop_front();
+            this->_queued.fetch_sub(1, std::memory_order_relaxed);
+            return (job);
+        }
+    }
+    return (nullptr);
+}
+
+void indie::core::JobSystem::execute(const std::shared_ptr<Job> &job)
+{
+    std::vector<std::shared_ptr<Job>> dependents;
+
+    {
+        TRACE_ZONE("JobSystem::job");
+        job->work();
+    }
+    // The captures are released now rather than with the last handle
+    job->work = nullptr;
+    {
+        std::lock_guard<std::mutex> guard(job->lock);
+        job->done.store(true, std::memory_order_release);
+        dependents.swap(job->dependents);
+    }
+    for (auto &dependent : dependents)
+        if (dependent->blockers.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            enqueue(std::move(dependent));
+}
+
+void indie::core::JobSystem::work(std::size_t index)
+{
+    _owner = this;
+    _index = index;
+    indie::profiling::Trace::setThreadName("worker " + std::to_string(index));
+    while (true) {
+        std::shared_ptr<Job> job = take(false);
+        if (job != nullptr) {
+            execute(job);
+            // Only between two jobs, a job waiting on another may still use the arena
+            indie::tools::FrameArena::local().reset();
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(this->_sleepLock);
+        this->_wake.wait(lock, [this]() {
+            return (this->_stopping || this->_queued.load(std::memory_order_acquire) > 0);
+        });
+        if (this->_stopping && this->_queued.load(std::memory_order_acquire) == 0)
+            return;
+    }
+}
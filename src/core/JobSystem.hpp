@@ -0,0 +1,213 @@
+/**
+ * @file JobSystem.hpp
+ * @brief Work stealing job system header file
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef JOBSYSTEM_HPP_
+#define JOBSYSTEM_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace indie::core
+{
+    /**
+     * @brief Pool of worker threads running jobs, with dependencies between jobs
+     *
+     * Each worker owns a deque: it pushes and pops the jobs it submits at the back, the other workers steal from the
+     * front when they run out of work, so related jobs stay on one core and the load still spreads. A job submitted
+     * with dependencies is queued when the last of them finishes. Jobs submitted for the main thread only run in
+     * runMainThreadJobs, or while the main thread waits, which is where GL calls belong.
+     *
+     * A thread waiting for a job runs other jobs meanwhile. Jobs must not throw, and the frame arena of a worker is
+     * reset after each of its jobs, so nothing a job allocates there may outlive it.
+     */
+    class JobSystem {
+      private:
+        struct Job;
+
+      public:
+        /// @brief Handle on a submitted job, a default handle is already finished
+        class Handle {
+          public:
+            /**
+             * @brief Construct a finished Handle object
+             *
+             */
+            Handle() = default;
+            /**
+             * @brief Check if the job finished
+             *
+             * @return true If the job ran
+             */
+            bool isDone() const;
+
+          private:
+            friend class JobSystem;
+            /// @brief The job
+            std::shared_ptr<Job> _job;
+        };
+
+        /**
+         * @brief Construct a new JobSystem object and start its workers
+         *
+         * @param workers Number of worker threads, 0 for one per core besides the main thread
+         */
+        explicit JobSystem(std::size_t workers = 0);
+        /**
+         * @brief Destroy the JobSystem object, finishing the queued jobs
+         *
+         */
+        ~JobSystem();
+        JobSystem(const JobSystem &) = delete;
+        JobSystem &operator=(const JobSystem &) = delete;
+
+        /**
+         * @brief Queue a job for the workers
+         *
+         * @param work The job
+         * @param dependencies Jobs that must finish before it starts
+         * @return Handle Handle on the job
+         */
+        Handle submit(std::function<void()> work, std::span<const Handle> dependencies = {});
+        /**
+         * @brief Queue a job for the main thread
+         *
+         * @param work The job
+         * @param dependencies Jobs that must finish before it starts
+         * @return Handle Handle on the job
+         */
+        Handle submitMain(std::function<void()> work, std::span<const Handle> dependencies = {});
+        /**
+         * @brief Wait for a job, running other jobs meanwhile
+         *
+         * @param handle The job
+         */
+        void wait(const Handle &handle);
+        /**
+         * @brief Run a function over a range split in chunks on every worker, returning once the range is done
+         *
+         * @param count Size of the range
+         * @param grain Smallest chunk worth a job
+         * @param work Function called with the first and past the last index of each chunk
+         */
+        void parallelFor(
+            std::size_t count, std::size_t grain, const std::function<void(std::size_t, std::size_t)> &work);
+        /**
+         * @brief Run the main thread jobs ready now, called once per frame by the main thread
+         *
+         */
+        void runMainThreadJobs();
+        /**
+         * @brief Get the number of worker threads
+         *
+         * @return std::size_t Number of workers
+         */
+        std::size_t getWorkerCount() const;
+        /**
+         * @brief Check if the calling thread is the one that created the job system
+         *
+         * @return true If called from the main thread
+         */
+        bool isMainThread() const;
+
+      private:
+        /// @brief A submitted job
+        struct Job {
+            /// @brief The work
+            std::function<void()> work;
+            /// @brief Whether it runs on the main thread
+            bool mainThread;
+            /// @brief Unfinished dependencies, plus one until the submission ends
+            std::atomic<int> blockers;
+            /// @brief Whether it ran
+            std::atomic<bool> done;
+            /// @brief Guards dependents against the end of the job
+            std::mutex lock;
+            /// @brief Jobs waiting for this one
+            std::vector<std::shared_ptr<Job>> dependents;
+        };
+        /// @brief A worker thread and its deque
+        struct Worker {
+            /// @brief Guards the deque
+            std::mutex lock;
+            /// @brief Jobs, the owner works at the back and the thieves at the front
+            std::deque<std::shared_ptr<Job>> jobs;
+            /// @brief The thread
+            std::thread thread;
+        };
+
+        /**
+         * @brief Create a job and queue it once its dependencies finished
+         *
+         * @param work The job
+         * @param dependencies Jobs that must finish before it starts
+         * @param mainThread Whether it runs on the main thread
+         * @return Handle Handle on the job
+         */
+        Handle create(std::function<void()> work, std::span<const Handle> dependencies, bool mainThread);
+        /**
+         * @brief Queue a job whose dependencies all finished
+         *
+         * @param job The job
+         */
+        void enqueue(std::shared_ptr<Job> job);
+        /**
+         * @brief Take a job, from the own deque first then from the others
+         *
+         * @param mainThread Whether the main thread queue may be used
+         * @return std::shared_ptr<Job> The job, or nullptr when there is none
+         */
+        std::shared_ptr<Job> take(bool mainThread);
+        /**
+         * @brief Run a job and queue the jobs it was the last dependency of
+         *
+         * @param job The job
+         */
+        void execute(const std::shared_ptr<Job> &job);
+        /**
+         * @brief Body of a worker thread
+         *
+         * @param index Index of the worker
+         */
+        void work(std::size_t index);
+
+        /// @brief Workers
+        std::vector<std::unique_ptr<Worker>> _workers;
+        /// @brief Jobs for the main thread
+        std::deque<std::shared_ptr<Job>> _mainJobs;
+        /// @brief Guards the main thread jobs
+        std::mutex _mainLock;
+        /// @brief Jobs queued for the workers and not taken yet
+        std::atomic<std::size_t> _queued;
+        /// @brief Worker receiving the next job submitted from outside the workers
+        std::atomic<std::size_t> _next;
+        /// @brief Guards the sleep of the workers
+        std::mutex _sleepLock;
+        /// @brief Wakes the workers up
+        std::condition_variable _wake;
+        /// @brief Set when the workers must end
+        bool _stopping;
+        /// @brief Thread that created the job system
+        std::thread::id _mainThread;
+        /// @brief Job system of the calling worker thread, nullptr outside the workers
+        static thread_local JobSystem *_owner;
+        /// @brief Index of the calling worker thread
+        static thread_local std::size_t _index;
+    };
+} // namespace indie::core
+
+#endif /* !JOBSYSTEM_HPP_ */
@@ -11,6 +11,8 @@
 
 #include "Drawable2D.hpp"
 #include "../IComponent.hpp"
+#include "../../../core/AssetLoader.hpp"
+#include "../../../profiling/Trace.hpp"
 
 indie::ecs::component::Drawable2D::Drawable2D()
 {
@@ -34,13 +36,14 @@ indie::ecs::component::Drawable2D::Drawable2D(float radius, Color color)
 
 indie::ecs::component::Drawable2D::Drawable2D(std::string texturePath, float height, float width, Color color)
 {
+    TRACE_ZONE("Drawable2D::load");
     this->_radius = 0.0;
     this->_height = height;
     this->_width = width;
     this->_color = color;
     this->_texturePath = texturePath;
     if (!texturePath.empty())
-        this->_texture = indie::raylib::Texture2D::load(texturePath.c_str());
+        this->_texture = indie::core::AssetLoader::loadTexture(texturePath);
     this->_compoType = indie::ecs::component::compoType::DRAWABLE2D;
     this->_drawableType = indie::ecs::component::drawableType::RECTANGLE;
 }
@@ -57,7 +60,7 @@ indie::ecs::component::Drawable2D::Drawable2D(std::string text, float fontSize,
     this->_drawableType = indie::ecs::component::drawableType::TEXT;
 }
 
-std::string indie::ecs::component::Drawable2D::getText()
+const std::string &indie::ecs::component::Drawable2D::getText() const
 {
     return (this->_text);
 }
@@ -69,6 +72,8 @@ float indie::ecs::component::Drawable2D::getFontSize()
 
 indie::ecs::component::Drawable2D::~Drawable2D()
 {
+    if (this->_texture.id != 0)
+        indie::raylib::Texture2D::unload(this->_texture);
 }
 
 indie::ecs::component::compoType indie::ecs::component::Drawable2D::getType() const
@@ -101,7 +106,7 @@ float indie::ecs::component::Drawable2D::getWidth()
     return (this->_width);
 }
 
-std::string indie::ecs::component::Drawable2D::getTexturePath() const
+const std::string &indie::ecs::component::Drawable2D::getTexturePath() const
 {
     return (this->_texturePath);
 }
@@ -118,9 +123,10 @@ Texture2D indie::ecs::component::Drawable2D::getTexture() const
 
 void indie::ecs::component::Drawable2D::setTexture(std::string texturePath)
 {
-    indie::raylib::Texture2D::unload(this->_texture);
+    if (this->_texture.id != 0)
+        indie::raylib::Texture2D::unload(this->_texture);
     this->_texturePath = texturePath;
-    this->_texture = indie::raylib::Texture2D::load(texturePath.c_str());
+    this->_texture = indie::core::AssetLoader::loadTexture(texturePath);
 }
 
 void indie::ecs::component::Drawable2D::setText(std::string text)
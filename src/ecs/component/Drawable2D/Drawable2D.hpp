@@ -55,6 +55,8 @@ namespace indie
                  * @brief Destroy the component.
                  */
                 ~Drawable2D();
+                Drawable2D(const Drawable2D &) = delete;
+                Drawable2D &operator=(const Drawable2D &) = delete;
                 /**
                  * @brief Get type of the component.
                  *
@@ -124,9 +126,9 @@ namespace indie
                 /**
                  * @brief Get the text value.
                  * 
-                 * @return std::string Text of the component
+                 * @return const std::string& Text of the component
                  */
-                std::string getText();
+                const std::string &getText() const;
                 /**
                  * @brief Set the text of the component
                  * 
@@ -137,9 +139,9 @@ namespace indie
                  * @brief Get the texture path of the component
 
                  * 
-                 * @return std::string Path to the texture of the component
+                 * @return const std::string& Path to the texture of the component
                  */
-                std::string getTexturePath() const;
+                const std::string &getTexturePath() const;
                 /**
                  * @brief Set the texture path of the component
                  * 
@@ -199,7 +201,7 @@ namespace indie
                  * @brief Texture2D Object
                  * 
                  */
-                Texture2D _texture;
+                Texture2D _texture = {};
                 /**
                  * @brief CompoType object
                  * 
@@ -11,6 +11,8 @@
 
 #include "Drawable3D.hpp"
 #include "../IComponent.hpp"
+#include "../../../core/AssetLoader.hpp"
+#include "../../../profiling/Trace.hpp"
 
 indie::ecs::component::Drawable3D::Drawable3D()
 {
@@ -37,19 +39,22 @@ indie::ecs::component::Drawable3D::Drawable3D(float radius, Color color)
 indie::ecs::component::Drawable3D::Drawable3D(
     std::string texturePath, float width, float height, float length, Color color)
 {
+    TRACE_ZONE("Drawable3D::load");
     this->_radius = 0.0;
     this->_height = height;
     this->_width = width;
     this->_length = length;
     this->_color = color;
     this->_texturePath = texturePath;
-    this->_texture = indie::raylib::Texture2D::load(texturePath.c_str());
+    this->_texture = indie::core::AssetLoader::loadTexture(texturePath);
     this->_compoType = indie::ecs::component::compoType::DRAWABLE3D;
     this->_drawableType = indie::ecs::component::drawableType::CUBE;
 }
 
 indie::ecs::component::Drawable3D::~Drawable3D()
 {
+    if (this->_texture.id != 0)
+        indie::raylib::Texture2D::unload(this->_texture);
 }
 
 indie::ecs::component::compoType indie::ecs::component::Drawable3D::getType() const
@@ -87,7 +92,7 @@ float indie::ecs::component::Drawable3D::getLength()
     return (this->_length);
 }
 
-std::string indie::ecs::component::Drawable3D::getTexturePath() const
+const std::string &indie::ecs::component::Drawable3D::getTexturePath() const
 {
     return (this->_texturePath);
 }
@@ -104,7 +109,8 @@ Texture2D indie::ecs::component::Drawable3D::getTexture() const
 
 void indie::ecs::component::Drawable3D::setTexture(std::string texturePath)
 {
-    indie::raylib::Texture2D::unload(this->_texture);
+    if (this->_texture.id != 0)
+        indie::raylib::Texture2D::unload(this->_texture);
     this->_texturePath = texturePath;
-    this->_texture = indie::raylib::Texture2D::load(texturePath.c_str());
+    this->_texture = indie::core::AssetLoader::loadTexture(texturePath);
 }
\ No newline at end of file
@@ -49,6 +49,8 @@ namespace indie
                  * @brief Destroy drawable 3d component.
                  */
                 ~Drawable3D();
+                Drawable3D(const Drawable3D &) = delete;
+                Drawable3D &operator=(const Drawable3D &) = delete;
                 /**
                  * @brief Get type of the component.
                  *
@@ -94,9 +96,9 @@ namespace indie
                 /**
                  * @brief Get the Texture Path of the component
                  * 
-                 * @return std::string Path to the texture of the component
+                 * @return const std::string& Path to the texture of the component
                  */
-                std::string getTexturePath() const;
+                const std::string &getTexturePath() const;
                 /**
                  * @brief Set the Texture Path of the component
                  * 
@@ -151,7 +153,7 @@ namespace indie
                  * @brief Texture2D object for the component
                  * 
                  */
-                Texture2D _texture;
+                Texture2D _texture = {};
                 /**
                  * @brief CompoType of the component
                  * 
@@ -18,16 +18,21 @@ indie::ecs::component::Explodable::Explodable()
     this->_dropped = true;
     this->_explode = false;
     this->_exploded = false;
+    this->_detonationTick = 0;
+    this->_fuseId = 0;
+    this->_player = 0;
 }
 
-indie::ecs::component::Explodable::Explodable(float range, int explosionTime) : _seconds(explosionTime)
+indie::ecs::component::Explodable::Explodable(float range, int explosionTime)
 {
     this->_range = range;
     this->_explosionTime = explosionTime;
     this->_dropped = true;
     this->_explode = false;
     this->_exploded = false;
-    this->_tStart = std::chrono::system_clock::now();
+    this->_detonationTick = 0;
+    this->_fuseId = 0;
+    this->_player = 0;
 }
 
 indie::ecs::component::Explodable::~Explodable()
@@ -89,14 +94,29 @@ bool indie::ecs::component::Explodable::getExploded() const
     return (this->_exploded);
 }
 
-std::chrono::time_point<std::chrono::system_clock> indie::ecs::component::Explodable::getTStart() const
+std::uint32_t indie::ecs::component::Explodable::getFuseTicks() const
 {
-    return (this->_tStart);
+    return (static_cast<std::uint32_t>(this->_explosionTime * TICKS_PER_SECOND));
 }
 
-std::chrono::seconds indie::ecs::component::Explodable::getSeconds() const
+void indie::ecs::component::Explodable::setDetonationTick(std::uint64_t tick)
 {
-    return (this->_seconds);
+    this->_detonationTick = tick;
+}
+
+std::uint64_t indie::ecs::component::Explodable::getDetonationTick() const
+{
+    return (this->_detonationTick);
+}
+
+void indie::ecs::component::Explodable::setFuseId(std::uint32_t fuseId)
+{
+    this->_fuseId = fuseId;
+}
+
+std::uint32_t indie::ecs::component::Explodable::getFuseId() const
+{
+    return (this->_fuseId);
 }
 
 int indie::ecs::component::Explodable::getPlayer() const
@@ -11,10 +11,13 @@
 
 #pragma once
 
-#include <chrono>
+#include <cstdint>
 #include "../../entity/Entity.hpp"
 #include "../IComponent.hpp"
 
+/// @brief Simulation ticks per second of fuse, the simulation runs one tick per frame at the base 60 fps
+#define TICKS_PER_SECOND 60
+
 namespace indie
 {
     namespace ecs
@@ -123,17 +126,35 @@ namespace indie
                  */
                 int getPlayer() const;
                 /**
-                 * @brief Get the Time point start 
+                 * @brief Get the length of the fuse
+                 * 
+                 * @return std::uint32_t Length of the fuse, in simulation ticks
+                 */
+                std::uint32_t getFuseTicks() const;
+                /**
+                 * @brief Set the tick the bomb explodes at, on the clock of the Explodable system
+                 * 
+                 * @param tick Detonation tick
+                 */
+                void setDetonationTick(std::uint64_t tick);
+                /**
+                 * @brief Get the tick the bomb explodes at, on the clock of the Explodable system
+                 * 
+                 * @return std::uint64_t Detonation tick
+                 */
+                std::uint64_t getDetonationTick() const;
+                /**
+                 * @brief Set the id of the fuse in the Explodable system
                  * 
-                 * @return std::chrono::time_point<std::chrono::system_clock> Time point start
+                 * @param fuseId Fuse id, 0 when the bomb is not armed
                  */
-                std::chrono::time_point<std::chrono::system_clock> getTStart() const;
+                void setFuseId(std::uint32_t fuseId);
                 /**
-                 * @brief Get the time in seconds from timer
+                 * @brief Get the id of the fuse in the Explodable system
                  * 
-                 * @return std::chrono::seconds Time from timer, in seconds
+                 * @return std::uint32_t Fuse id, 0 when the bomb is not armed
                  */
-                std::chrono::seconds getSeconds() const;
+                std::uint32_t getFuseId() const;
 
               private:
                 /**
@@ -162,15 +183,15 @@ namespace indie
                  */
                 bool _exploded;
                 /**
-                 * @brief Time point for explosion time
+                 * @brief Detonation tick
                  * 
                  */
-                std::chrono::time_point<std::chrono::system_clock> _tStart;
+                std::uint64_t _detonationTick;
                 /**
-                 * @brief Time in seconds, for explosion time
+                 * @brief Fuse id
                  * 
                  */
-                std::chrono::seconds _seconds;
+                std::uint32_t _fuseId;
                 /**
                  * @brief Player's number
                  * 
@@ -40,6 +40,7 @@ namespace indie
                 DESTROYABLE,
                 MODEL,
                 ANIMATED,
+                PLAYERCONTROL,
                 UNKNOWNCOMPO
             };
             /**
@@ -11,15 +11,18 @@
 
 #include "Object.hpp"
 #include "../IComponent.hpp"
+#include "../../../core/AssetLoader.hpp"
+#include "../../../profiling/Trace.hpp"
 
 indie::ecs::component::Object::Object(std::string const &texturePath, std::string const &objectPath,
     std::string const &animationsPath, vec3f scaleVec, vec3f rotationVec, float orientation)
 {
+    TRACE_ZONE("Object::loadAnimated");
     this->_height = 0.0;
     this->_width = 0.0;
     this->_color = WHITE;
     this->_texturePath = texturePath;
-    this->_texture = indie::raylib::Texture2D::load(texturePath.c_str());
+    this->_texture = indie::core::AssetLoader::loadTexture(texturePath);
     this->_modelPath = objectPath;
     this->_maxCounter = 0;
     this->_animationCounter = 0;
@@ -37,11 +40,12 @@ indie::ecs::component::Object::Object(std::string const &texturePath, std::strin
 indie::ecs::component::Object::Object(
     std::string const &texturePath, std::string const &objectPath, vec3f scaleVec, vec3f rotationVec, float orientation)
 {
+    TRACE_ZONE("Object::load");
     this->_height = 0.0;
     this->_width = 0.0;
     this->_color = WHITE;
     this->_texturePath = texturePath;
-    this->_texture = indie::raylib::Texture2D::load(texturePath.c_str());
+    this->_texture = indie::core::AssetLoader::loadTexture(texturePath);
     this->_modelPath = objectPath;
     this->_model = indie::raylib::Model::load(objectPath.c_str());
     indie::raylib::Model::setMaterialTexture(&this->_model.materials[0], MATERIAL_MAP_DIFFUSE, this->_texture);
@@ -107,7 +111,7 @@ void indie::ecs::component::Object::setTexture(std::string texturePath)
 {
     indie::raylib::Texture2D::unload(this->_texture);
     this->_texturePath = texturePath;
-    this->_texture = indie::raylib::Texture2D::load(texturePath.c_str());
+    this->_texture = indie::core::AssetLoader::loadTexture(texturePath);
 }
 
 std::string indie::ecs::component::Object::getModelPath() const
@@ -0,0 +1,52 @@
+/**
+ * @file PlayerControl.cpp
+ * @brief PlayerControl component source file
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "PlayerControl.hpp"
+
+indie::ecs::component::PlayerControl::PlayerControl(int player)
+{
+    this->_player = player;
+    this->_direction = indie::Event::JOYSTICK_NONE;
+    this->_bombRequested = false;
+}
+
+indie::ecs::component::PlayerControl::~PlayerControl()
+{
+}
+
+int indie::ecs::component::PlayerControl::getPlayer() const
+{
+    return (this->_player);
+}
+
+void indie::ecs::component::PlayerControl::setDirection(indie::Event::JoystickDirection direction)
+{
+    this->_direction = direction;
+}
+
+indie::Event::JoystickDirection indie::ecs::component::PlayerControl::getDirection() const
+{
+    return (this->_direction);
+}
+
+void indie::ecs::component::PlayerControl::setBombRequested(bool bombRequested)
+{
+    this->_bombRequested = bombRequested;
+}
+
+bool indie::ecs::component::PlayerControl::getBombRequested() const
+{
+    return (this->_bombRequested);
+}
+
+indie::ecs::component::compoType indie::ecs::component::PlayerControl::getType() const
+{
+    return (indie::ecs::component::compoType::PLAYERCONTROL);
+}
@@ -0,0 +1,96 @@
+/**
+ * @file PlayerControl.hpp
+ * @brief PlayerControl component header file
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PLAYERCONTROL_HPP_
+#define PLAYERCONTROL_HPP_
+
+#include "../IComponent.hpp"
+#include "events.hpp"
+
+namespace indie
+{
+    namespace ecs
+    {
+        namespace component
+        {
+            /// @brief PlayerControl component, the input of the player owning the entity
+            class PlayerControl : public IComponent {
+              public:
+                /**
+                 * @brief Construct a new PlayerControl object
+                 *
+                 * @param player Index of the player, and of the controller driving it
+                 */
+                PlayerControl(int player);
+                /**
+                 * @brief Destroy the PlayerControl object
+                 *
+                 */
+                ~PlayerControl();
+                /**
+                 * @brief Get the player index
+                 *
+                 * @return int Index of the player
+                 */
+                int getPlayer() const;
+                /**
+                 * @brief Set the requested direction
+                 *
+                 * @param direction Direction of the left joystick
+                 */
+                void setDirection(indie::Event::JoystickDirection direction);
+                /**
+                 * @brief Get the requested direction
+                 *
+                 * @return indie::Event::JoystickDirection Direction of the left joystick
+                 */
+                indie::Event::JoystickDirection getDirection() const;
+                /**
+                 * @brief Set whether the player asked for a bomb this tick
+                 *
+                 * @param bombRequested True if a bomb must be placed
+                 */
+                void setBombRequested(bool bombRequested);
+                /**
+                 * @brief Did the player ask for a bomb this tick?
+                 *
+                 * @return true A bomb must be placed
+                 * @return false Otherwise
+                 */
+                bool getBombRequested() const;
+                /**
+                 * @brief Get the Type object
+                 *
+                 * @return indie::ecs::component::compoType CompoType of the component.
+                 */
+                indie::ecs::component::compoType getType() const;
+
+              private:
+                /**
+                 * @brief Index of the player
+                 *
+                 */
+                int _player;
+                /**
+                 * @brief Requested direction
+                 *
+                 */
+                indie::Event::JoystickDirection _direction;
+                /**
+                 * @brief Is a bomb requested?
+                 *
+                 */
+                bool _bombRequested;
+            };
+        } // namespace component
+    }     // namespace ecs
+} // namespace indie
+
+#endif /* !PLAYERCONTROL_HPP_ */
@@ -15,6 +15,9 @@ indie::ecs::component::Sound::Sound(std::string soundPath, bool play, float volu
 {
     this->_play = play;
     this->_volume = volume;
+    this->_bankId = -1;
+    this->_category = indie::audio::SoundCategory::INTERFACE;
+    this->_priority = 0.0f;
 }
 
 indie::ecs::component::Sound::~Sound()
@@ -46,9 +49,40 @@ float indie::ecs::component::Sound::getVolume() const
     return (this->_volume);
 }
 
+int indie::ecs::component::Sound::getBankId() const
+{
+    return (this->_bankId);
+}
+
+void indie::ecs::component::Sound::setBankId(int bankId)
+{
+    this->_bankId = bankId;
+}
+
+indie::audio::SoundCategory indie::ecs::component::Sound::getCategory() const
+{
+    return (this->_category);
+}
+
+void indie::ecs::component::Sound::setCategory(indie::audio::SoundCategory category)
+{
+    this->_category = category;
+}
+
+float indie::ecs::component::Sound::getPriority() const
+{
+    return (this->_priority);
+}
+
+void indie::ecs::component::Sound::setPriority(float priority)
+{
+    this->_priority = priority;
+}
+
 void indie::ecs::component::Sound::setSoundPath(std::string soundPath)
 {
     this->_soundPath = soundPath;
+    this->_bankId = -1;
 }
 
 /*void indie::ecs::component::Sound::setSound(std::string soundPath)
@@ -12,6 +12,7 @@
 #pragma once
 
 #include "../IComponent.hpp"
+#include "../../../audio/SoundCategory.hpp"
 
 namespace indie
 {
@@ -66,6 +67,42 @@ namespace indie
                  * @return float The volume 
                  */
                 float getVolume() const;
+                /**
+                 * @brief Get the id of the sound in the sound bank
+                 * 
+                 * @return int The id, -1 until the sound system resolved it
+                 */
+                int getBankId() const;
+                /**
+                 * @brief Set the id of the sound in the sound bank
+                 * 
+                 * @param bankId The id
+                 */
+                void setBankId(int bankId);
+                /**
+                 * @brief Get the category of the sound
+                 * 
+                 * @return indie::audio::SoundCategory The category, its volume scales the sound
+                 */
+                indie::audio::SoundCategory getCategory() const;
+                /**
+                 * @brief Set the category of the sound
+                 * 
+                 * @param category The category
+                 */
+                void setCategory(indie::audio::SoundCategory category);
+                /**
+                 * @brief Get the priority of the next play
+                 * 
+                 * @return float The priority, higher is more important
+                 */
+                float getPriority() const;
+                /**
+                 * @brief Set the priority of the next play
+                 * 
+                 * @param priority The priority, higher is more important
+                 */
+                void setPriority(float priority);
                 /**
                  * @brief Set the Sound Path 
                  * 
@@ -103,6 +140,21 @@ namespace indie
                  */
                 bool _play;
                 float _volume;
+                /**
+                 * @brief Id of the sound in the sound bank
+                 * 
+                 */
+                int _bankId;
+                /**
+                 * @brief Category of the sound
+                 * 
+                 */
+                indie::audio::SoundCategory _category;
+                /**
+                 * @brief Priority of the next play
+                 * 
+                 */
+                float _priority;
             };
         } // namespace component
     }     // namespace ecs
@@ -10,18 +10,22 @@
  */
 
 #include "Entity.hpp"
+#include "../../profiling/Counters.hpp"
 
 indie::ecs::entity::Entity::Entity()
 {
+    COUNTER_INC(ENTITIES_SPAWNED);
 }
 
 indie::ecs::entity::Entity::Entity(indie::ecs::entity::entityType type)
 {
     this->_type = type;
+    COUNTER_INC(ENTITIES_SPAWNED);
 }
 
 indie::ecs::entity::Entity::~Entity()
 {
+    COUNTER_INC(ENTITIES_DESTROYED);
 }
 
 indie::ecs::entity::entityType indie::ecs::entity::Entity::getEntityType() const
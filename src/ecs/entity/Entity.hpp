@@ -26,7 +26,10 @@
 #include "../component/IComponent.hpp"
 #include "../component/Inventory/Inventory.hpp"
 #include "../component/Object/Object.hpp"
+#include "../component/PlayerControl/PlayerControl.hpp"
 #include "../component/Sound/Sound.hpp"
+#include "../../profiling/Counters.hpp"
+#include "../../tools/FrameArena.hpp"
 #include "../component/Transform/Transform.hpp"
 
 namespace indie
@@ -38,8 +41,10 @@ namespace indie
             /**
              * @brief Entity Type for entity object creation
              *
+             * Every player is a PLAYER entity, told apart by the index of its PlayerControl component. The other
+             * values keep the numbers they had with the four player types, as the journals store them.
              */
-            enum entityType { PLAYER_1, PLAYER_2, PLAYER_3, PLAYER_4, WALL, BOXES, TEXT, BOMB, UNKNOWN };
+            enum entityType { PLAYER, WALL = 4, BOXES, TEXT, BOMB, UNKNOWN };
             /// @brief Entity class
             class Entity {
               public:
@@ -89,13 +94,15 @@ namespace indie
                 /**
                  * @brief Get the Drawable Vector
                  *
-                 * @return std::vector<indie::ecs::component::Drawable2D *> Vector of Drawable2D component
+                 * @return indie::tools::FrameVector<indie::ecs::component::Drawable2D *> Vector of Drawable2D
+                 * component, valid until the end of the frame
                  */
-                std::vector<indie::ecs::component::Drawable2D *> getDrawableVector() const
+                indie::tools::FrameVector<indie::ecs::component::Drawable2D *> getDrawableVector() const
                 {
-                    std::vector<indie::ecs::component::Drawable2D *> vector;
+                    indie::tools::FrameVector<indie::ecs::component::Drawable2D *> vector;
                     for (auto &compo : _componentVector) {
                         if (compo->getType() == indie::ecs::component::compoType::DRAWABLE2D) {
+                            COUNTER_INC(DYNAMIC_CAST);
                             vector.push_back(dynamic_cast<indie::ecs::component::Drawable2D *>(compo.get()));
                         }
                     }
@@ -111,8 +118,10 @@ namespace indie
                  */
                 template <typename T> T *getComponent(indie::ecs::component::compoType type)
                 {
+                    COUNTER_INC(GET_COMPONENT);
                     for (auto &compo : _componentVector) {
                         if (compo->getType() == type) {
+                            COUNTER_INC(DYNAMIC_CAST);
                             return (dynamic_cast<T *>(compo.get()));
                         }
                     }
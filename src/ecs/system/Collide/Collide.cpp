@@ -10,8 +10,11 @@
  */
 
 #include "Collide.hpp"
+#include <algorithm>
+#include "../../../profiling/Counters.hpp"
+#include "../../../save/Journal.hpp"
 
-indie::ecs::system::Collide::Collide()
+indie::ecs::system::Collide::Collide() : _journal(nullptr)
 {
 }
 
@@ -24,8 +27,28 @@ indie::ecs::system::SystemType indie::ecs::system::Collide::getSystemType() cons
     return (indie::ecs::system::SystemType::COLLIDESYSTEM);
 }
 
+indie::ecs::system::Access indie::ecs::system::Collide::getAccess() const
+{
+    indie::ecs::system::Access access = {};
+
+    // The collected bonuses unload their textures and models when erased, flush does it on the main thread
+    access.reads = componentBit(component::TRANSFORM) | componentBit(component::COLLIDE)
+        | componentBit(component::COLLECTABLE) | componentBit(component::INVENTORY)
+        | componentBit(component::DRAWABLE3D) | componentBit(component::MODEL) | componentBit(component::ANIMATED);
+    access.writes = componentBit(component::TRANSFORM) | componentBit(component::COLLIDE)
+        | componentBit(component::INVENTORY);
+    access.structural = false;
+    access.mainThread = false;
+    return (access);
+}
+
+void indie::ecs::system::Collide::setJournal(indie::save::Journal *journal)
+{
+    this->_journal = journal;
+}
+
 void indie::ecs::system::Collide::checkSphereCollision(std::unique_ptr<indie::ecs::entity::Entity> &entity,
-    std::unique_ptr<indie::ecs::entity::Entity> &otherEntity, std::vector<int> &compoToRemove, int &count)
+    std::unique_ptr<indie::ecs::entity::Entity> &otherEntity, indie::tools::FrameVector<int> &compoToRemove, int &count)
 {
     auto transform = entity->getComponent<indie::ecs::component::Transform>(indie::ecs::component::TRANSFORM);
     auto drawable = entity->getComponent<indie::ecs::component::Drawable3D>(indie::ecs::component::DRAWABLE3D);
@@ -76,11 +99,12 @@ Vector3 Vector3Add(Vector3 v1, Vector3 v2)
 
 bool indie::ecs::system::Collide::checkCollision(std::unique_ptr<indie::ecs::entity::Entity> &entity,
     std::unique_ptr<indie::ecs::entity::Entity> &otherEntity, indie::ecs::component::Collide *collide,
-    indie::ecs::component::Collide *otherEntityCollide, std::vector<int> &compoToRemove, int &count)
+    indie::ecs::component::Collide *otherEntityCollide, indie::tools::FrameVector<int> &compoToRemove, int &count)
 {
     auto transform = entity->getComponent<indie::ecs::component::Transform>(indie::ecs::component::TRANSFORM);
     auto otherTransform = otherEntity->getComponent<indie::ecs::component::Transform>(indie::ecs::component::TRANSFORM);
 
+    COUNTER_INC(COLLISION_TESTS);
     if (otherEntity->hasCompoType(indie::ecs::component::ANIMATED)
         && entity->hasCompoType(indie::ecs::component::MODEL)) {
         BoundingBox box1 = indie::raylib::BoundingBox::getModelBox(
@@ -145,7 +169,7 @@ bool indie::ecs::system::Collide::checkCollision(std::unique_ptr<indie::ecs::ent
 void indie::ecs::system::Collide::update(std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities)
 {
     int count = 0;
-    std::vector<int> compoToRemove;
+    indie::tools::FrameVector<int> compoToRemove;
 
     for (auto &entity : entities) {
         if (entity->hasCompoType(ecs::component::compoType::COLLIDE) == true) {
@@ -164,9 +188,32 @@ void indie::ecs::system::Collide::update(std::vector<std::unique_ptr<indie::ecs:
         count++;
     }
 
-    size_t i = 0;
-    for (auto &index : compoToRemove) {
-        entities.erase(entities.begin() + index - i);
-        i++;
+    for (auto &index : compoToRemove)
+        this->_removed.push_back(entities.at(index).get());
+}
+
+void indie::ecs::system::Collide::flush(std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities)
+{
+    size_t write = 0;
+
+    if (this->_removed.empty())
+        return;
+    for (size_t read = 0; read < entities.size(); read++) {
+        auto &entity = entities[read];
+        // A bonus touched by two players is listed twice, it is erased and journaled once
+        if (std::find(this->_removed.begin(), this->_removed.end(), entity.get()) != this->_removed.end()) {
+            if (this->_journal != nullptr) {
+                auto transformCompo =
+                    entity->getComponent<ecs::component::Transform>(ecs::component::compoType::TRANSFORM);
+                this->_journal->entityDestroyed(
+                    entity->getEntityType(), transformCompo->getX(), transformCompo->getY());
+            }
+            continue;
+        }
+        if (write != read)
+            entities[write] = std::move(entity);
+        write++;
     }
+    entities.resize(write);
+    this->_removed.clear();
 }
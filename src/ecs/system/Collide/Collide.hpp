@@ -12,10 +12,16 @@
 #ifndef COLLIDE_HPP_
 #define COLLIDE_HPP_
 
+#include <vector>
 #include "../ISystem.hpp"
+#include "../../../tools/FrameArena.hpp"
 
 namespace indie
 {
+    namespace save
+    {
+        class Journal;
+    } // namespace save
     namespace ecs
     {
         namespace system
@@ -51,7 +57,8 @@ namespace indie
                  */
                 bool checkCollision(std::unique_ptr<indie::ecs::entity::Entity> &entity,
                     std::unique_ptr<indie::ecs::entity::Entity> &otherEntity, indie::ecs::component::Collide *collide,
-                    indie::ecs::component::Collide *otherEntityCollide, std::vector<int> &compoToRemove, int &count);
+                    indie::ecs::component::Collide *otherEntityCollide, indie::tools::FrameVector<int> &compoToRemove,
+                    int &count);
                 /**
                  * @brief Check collisions between spheres
                  *
@@ -61,8 +68,8 @@ namespace indie
                  * @param count Counter
                  */
                 void checkSphereCollision(std::unique_ptr<indie::ecs::entity::Entity> &entity,
-                    std::unique_ptr<indie::ecs::entity::Entity> &otherEntity, std::vector<int> &compoToRemove,
-                    int &count);
+                    std::unique_ptr<indie::ecs::entity::Entity> &otherEntity,
+                    indie::tools::FrameVector<int> &compoToRemove, int &count);
 
                 /**
                  * @brief Get the type of system.
@@ -70,9 +77,37 @@ namespace indie
                  * @return indie::ecs::system::SystemType SystemType
                  */
                 indie::ecs::system::SystemType getSystemType() const;
+                /**
+                 * @brief Get what the system touches
+                 *
+                 * @return indie::ecs::system::Access Components read and written
+                 */
+                indie::ecs::system::Access getAccess() const;
+                /**
+                 * @brief Set the journal receiving the collected bonuses
+                 *
+                 * @param journal Autosave journal, nullptr to disable journaling
+                 */
+                void setJournal(indie::save::Journal *journal);
+                /**
+                 * @brief Erase the bonuses collected during the last update, journaling their removal
+                 *
+                 * @param entities vector of entites the update ran on
+                 */
+                void flush(std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities);
 
               protected:
               private:
+                /**
+                 * @brief Autosave journal
+                 *
+                 */
+                indie::save::Journal *_journal;
+                /**
+                 * @brief Bonuses collected during the last update, erased by flush
+                 *
+                 */
+                std::vector<indie::ecs::entity::Entity *> _removed;
             };
         } // namespace system
     }     // namespace ecs
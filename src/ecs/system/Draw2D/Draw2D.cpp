@@ -10,12 +10,14 @@
  */
 
 #include "Draw2D.hpp"
+#include "../../../profiling/FrameStats.hpp"
 
 void indie::ecs::system::Draw2DSystem::drawText(auto drawableCompo, auto transformCompo)
 {
     indie::raylib::Draw text(
         transformCompo->getX(), transformCompo->getY(), drawableCompo->getFontSize(), drawableCompo->getColor());
     text.drawText(drawableCompo->getText());
+    indie::profiling::FrameStats::countDrawCalls();
 }
 
 void indie::ecs::system::Draw2DSystem::drawRectangle(auto drawableCompo, auto transformCompo)
@@ -30,6 +32,7 @@ void indie::ecs::system::Draw2DSystem::drawRectangle(auto drawableCompo, auto tr
         indie::raylib::Texture2D::draw(
             texture, transformCompo->getX(), transformCompo->getY(), drawableCompo->getColor());
     }
+    indie::profiling::FrameStats::countDrawCalls();
 }
 
 indie::ecs::system::SystemType indie::ecs::system::Draw2DSystem::getSystemType() const
@@ -37,10 +40,22 @@ indie::ecs::system::SystemType indie::ecs::system::Draw2DSystem::getSystemType()
     return (indie::ecs::system::SystemType::DRAWABLE2DSYSTEM);
 }
 
+indie::ecs::system::Access indie::ecs::system::Draw2DSystem::getAccess() const
+{
+    indie::ecs::system::Access access = {};
+
+    access.reads = componentBit(component::DRAWABLE2D) | componentBit(component::TRANSFORM)
+        | componentBit(component::ALIVE);
+    access.writes = 0;
+    access.structural = false;
+    access.mainThread = true;
+    return (access);
+}
+
 void indie::ecs::system::Draw2DSystem::update(std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities)
 {
     for (auto &entity : entities) {
-        std::vector<indie::ecs::component::Drawable2D *> compoVector = entity->getDrawableVector();
+        indie::tools::FrameVector<indie::ecs::component::Drawable2D *> compoVector = entity->getDrawableVector();
         if (entity->hasCompoType(indie::ecs::component::compoType::ALIVE)
             && entity->getComponent<indie::ecs::component::Alive>(indie::ecs::component::compoType::ALIVE)->getAlive()
                 == false) {
@@ -55,6 +70,7 @@ void indie::ecs::system::Draw2DSystem::update(std::vector<std::unique_ptr<indie:
                         case indie::ecs::component::drawableType::CIRCLE:
                             indie::raylib::Circle::draw(
                                 transformCompo->getX(), transformCompo->getY(), compo->getRadius(), compo->getColor());
+                            indie::profiling::FrameStats::countDrawCalls();
                         case indie::ecs::component::drawableType::TEXT: drawText(compo, transformCompo);
                         case indie::ecs::component::drawableType::RECTANGLE: drawRectangle(compo, transformCompo);
                         default: continue;
@@ -72,6 +88,7 @@ void indie::ecs::system::Draw2DSystem::update(std::vector<std::unique_ptr<indie:
                     case indie::ecs::component::drawableType::CIRCLE:
                         indie::raylib::Circle::draw(transformCompo->getX(), transformCompo->getY(),
                             drawableCompo->getRadius(), drawableCompo->getColor());
+                        indie::profiling::FrameStats::countDrawCalls();
                     case indie::ecs::component::drawableType::TEXT: drawText(drawableCompo, transformCompo);
                     case indie::ecs::component::drawableType::RECTANGLE: drawRectangle(drawableCompo, transformCompo);
                     default: continue;
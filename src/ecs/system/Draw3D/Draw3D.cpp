@@ -10,12 +10,25 @@
  */
 
 #include "Draw3D.hpp"
+#include "../../../profiling/FrameStats.hpp"
 
 indie::ecs::system::SystemType indie::ecs::system::Draw3DSystem::getSystemType() const
 {
     return (indie::ecs::system::SystemType::DRAWABLE3DSYSTEM);
 }
 
+indie::ecs::system::Access indie::ecs::system::Draw3DSystem::getAccess() const
+{
+    indie::ecs::system::Access access = {};
+
+    access.reads = componentBit(component::DRAWABLE3D) | componentBit(component::TRANSFORM)
+        | componentBit(component::ALIVE);
+    access.writes = 0;
+    access.structural = false;
+    access.mainThread = true;
+    return (access);
+}
+
 void indie::ecs::system::Draw3DSystem::drawSphere(auto drawableCompo, auto transformCompo)
 {
     Vector3 pos = {0.0, 0.0, 0.0};
@@ -23,6 +36,7 @@ void indie::ecs::system::Draw3DSystem::drawSphere(auto drawableCompo, auto trans
     pos = {transformCompo->getX(), transformCompo->getZ(), transformCompo->getY()};
     indie::raylib::Sphere::draw(pos, drawableCompo->getRadius(), drawableCompo->getColor());
     indie::raylib::Sphere::drawWires(pos, drawableCompo->getRadius(), 50, 5.0, BLACK);
+    indie::profiling::FrameStats::countDrawCalls(2);
 }
 
 void indie::ecs::system::Draw3DSystem::drawCube(auto drawableCompo, auto transformCompo)
@@ -34,9 +48,11 @@ void indie::ecs::system::Draw3DSystem::drawCube(auto drawableCompo, auto transfo
     if (drawableCompo->getTexturePath() == "") {
         indie::raylib::Cube::draw(pos, size, drawableCompo->getColor());
         indie::raylib::Cube::drawWires(pos, size, BLACK);
+        indie::profiling::FrameStats::countDrawCalls(2);
     } else {
         indie::raylib::Cube::drawTexture(drawableCompo->getTexture(), pos, drawableCompo->getWidth(),
             drawableCompo->getHeight(), drawableCompo->getLength(), drawableCompo->getColor());
+        indie::profiling::FrameStats::countDrawCalls();
     }
 }
 
@@ -60,6 +60,12 @@ namespace indie
                  * @return indie::ecs::system::SystemType SystemType
                  */
                 indie::ecs::system::SystemType getSystemType() const override;
+                /**
+                 * @brief Get what the system touches
+                 *
+                 * @return indie::ecs::system::Access Components read and written
+                 */
+                indie::ecs::system::Access getAccess() const override;
 
               private:
             };
@@ -0,0 +1,175 @@
+/**
+ * @file DetonationResolver.cpp
+ * @brief Chain reaction resolver source file
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "DetonationResolver.hpp"
+#include "../../../profiling/Counters.hpp"
+#include <algorithm>
+#include <cmath>
+
+indie::ecs::system::DetonationResolver::DetonationResolver()
+    : _head(BLAST_GRID_COLUMNS * BLAST_GRID_ROWS, -1), _blocked(BLAST_GRID_COLUMNS * BLAST_GRID_ROWS, false),
+      _burning(BLAST_GRID_COLUMNS * BLAST_GRID_ROWS, 0), _stamp(0)
+{
+}
+
+indie::ecs::system::DetonationResolver::~DetonationResolver()
+{
+}
+
+int indie::ecs::system::DetonationResolver::getTile(float x, float y)
+{
+    long column = std::lround((x - BLAST_GRID_LEFT) / BLAST_TILE_SIZE);
+    long row = std::lround((BLAST_GRID_TOP - y) / BLAST_TILE_SIZE);
+
+    if (column < 0 || column >= BLAST_GRID_COLUMNS || row < 0 || row >= BLAST_GRID_ROWS)
+        return (-1);
+    return (static_cast<int>(row * BLAST_GRID_COLUMNS + column));
+}
+
+void indie::ecs::system::DetonationResolver::indexEntities(
+    std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities)
+{
+    std::fill(this->_head.begin(), this->_head.end(), -1);
+    std::fill(this->_blocked.begin(), this->_blocked.end(), false);
+    this->_next.assign(entities.size(), -1);
+    this->_tileOf.assign(entities.size(), -1);
+    if (this->_queued.size() < entities.size())
+        this->_queued.resize(entities.size(), 0);
+    for (size_t index = 0; index < entities.size(); index++) {
+        auto &entity = entities[index];
+        bool bomb = entity->hasCompoType(indie::ecs::component::EXPLODABLE);
+
+        // The floor, the bonuses and the dead players are not affected by the flames
+        if ((!bomb && !entity->hasCompoType(indie::ecs::component::COLLIDE))
+            || entity->hasCompoType(indie::ecs::component::COLLECTABLE))
+            continue;
+        if (entity->hasCompoType(indie::ecs::component::ALIVE)
+            && !entity->getComponent<indie::ecs::component::Alive>(indie::ecs::component::ALIVE)->getAlive())
+            continue;
+        if (bomb
+            && entity->getComponent<indie::ecs::component::Explodable>(indie::ecs::component::EXPLODABLE)
+                   ->getExploded())
+            continue;
+        auto transform = entity->getComponent<indie::ecs::component::Transform>(indie::ecs::component::TRANSFORM);
+        if (transform == nullptr)
+            continue;
+        int tile = getTile(transform->getX(), transform->getY());
+        if (tile < 0)
+            continue;
+        this->_tileOf[index] = tile;
+        this->_next[index] = this->_head[tile];
+        this->_head[tile] = static_cast<int>(index);
+        if (!bomb && !entity->hasCompoType(indie::ecs::component::DESTROYABLE))
+            this->_blocked[tile] = true;
+    }
+}
+
+bool indie::ecs::system::DetonationResolver::isBlocked(int tile) const
+{
+    return (this->_blocked[tile]);
+}
+
+void indie::ecs::system::DetonationResolver::enqueue(size_t bomb)
+{
+    if (this->_queued[bomb] == this->_stamp)
+        return;
+    this->_queued[bomb] = this->_stamp;
+    this->_queue.push_back(bomb);
+}
+
+void indie::ecs::system::DetonationResolver::burn(
+    std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities, int tile)
+{
+    COUNTER_INC(BLAST_LOOKUPS);
+    if (this->_burning[tile] == this->_stamp)
+        return;
+    this->_burning[tile] = this->_stamp;
+    this->_flames.push_back(tile);
+    for (int index = this->_head[tile]; index != -1; index = this->_next[index]) {
+        if (entities[index]->hasCompoType(indie::ecs::component::EXPLODABLE))
+            enqueue(static_cast<size_t>(index));
+        else if (entities[index]->hasCompoType(indie::ecs::component::DESTROYABLE))
+            this->_burnt.push_back(static_cast<size_t>(index));
+    }
+}
+
+void indie::ecs::system::DetonationResolver::detonate(
+    std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities, size_t bomb)
+{
+    static const int steps[4][2] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
+    int tile = this->_tileOf[bomb];
+    int column = tile % BLAST_GRID_COLUMNS;
+    int row = tile / BLAST_GRID_COLUMNS;
+    int reach = static_cast<int>(std::ceil(
+        entities[bomb]->getComponent<indie::ecs::component::Explodable>(indie::ecs::component::EXPLODABLE)->getRange()
+        / BLAST_TILE_SIZE));
+
+    burn(entities, tile);
+    for (auto &step : steps) {
+        for (int distance = 1; distance <= reach; distance++) {
+            int x = column + step[0] * distance;
+            int y = row + step[1] * distance;
+            if (x < 0 || x >= BLAST_GRID_COLUMNS || y < 0 || y >= BLAST_GRID_ROWS)
+                break;
+            int target = y * BLAST_GRID_COLUMNS + x;
+            if (isBlocked(target))
+                break;
+            burn(entities, target);
+        }
+    }
+}
+
+void indie::ecs::system::DetonationResolver::resolve(
+    std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities,
+    std::span<indie::ecs::entity::Entity *const> triggered)
+{
+    this->_detonated.clear();
+    this->_flames.clear();
+    this->_burnt.clear();
+    this->_queue.clear();
+    if (triggered.empty())
+        return;
+    if (++this->_stamp == 0) {
+        std::fill(this->_burning.begin(), this->_burning.end(), 0);
+        std::fill(this->_queued.begin(), this->_queued.end(), 0);
+        this->_stamp = 1;
+    }
+    indexEntities(entities);
+    // The triggered bombs are found through their tile, not by scanning the entities again
+    for (auto bomb : triggered) {
+        auto transform = bomb->getComponent<indie::ecs::component::Transform>(indie::ecs::component::TRANSFORM);
+        int tile = transform == nullptr ? -1 : getTile(transform->getX(), transform->getY());
+        if (tile < 0)
+            continue;
+        for (int index = this->_head[tile]; index != -1; index = this->_next[index])
+            if (entities[index].get() == bomb)
+                enqueue(static_cast<size_t>(index));
+    }
+    for (size_t next = 0; next < this->_queue.size(); next++) {
+        detonate(entities, this->_queue[next]);
+        this->_detonated.push_back(entities[this->_queue[next]].get());
+    }
+    std::sort(this->_burnt.begin(), this->_burnt.end());
+}
+
+const std::vector<indie::ecs::entity::Entity *> &indie::ecs::system::DetonationResolver::getDetonated() const
+{
+    return (this->_detonated);
+}
+
+const std::vector<int> &indie::ecs::system::DetonationResolver::getFlameTiles() const
+{
+    return (this->_flames);
+}
+
+const std::vector<size_t> &indie::ecs::system::DetonationResolver::getBurnt() const
+{
+    return (this->_burnt);
+}
@@ -0,0 +1,190 @@
+/**
+ * @file DetonationResolver.hpp
+ * @brief Chain reaction resolver header file
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef DETONATIONRESOLVER_HPP_
+#define DETONATIONRESOLVER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+#include "../../entity/Entity.hpp"
+
+/// @brief Columns of the blast grid
+#define BLAST_GRID_COLUMNS 21
+/// @brief Rows of the blast grid
+#define BLAST_GRID_ROWS 21
+/// @brief World x of the first column
+#define BLAST_GRID_LEFT -20.0f
+/// @brief World y of the first row
+#define BLAST_GRID_TOP 20.0f
+/// @brief Width of a tile, in world units
+#define BLAST_TILE_SIZE 2.0f
+
+namespace indie
+{
+    namespace ecs
+    {
+        namespace system
+        {
+            /**
+             * @brief Resolves every detonation of a tick at once
+             *
+             * The entities are bucketed by tile once, then the triggered bombs are expanded breadth-first: each bomb
+             * casts its four rays over the grid, and the bombs its flames reach join the queue. Every flame tile is
+             * visited once, whatever the number of bombs covering it.
+             */
+            class DetonationResolver {
+              public:
+                /**
+                 * @brief Construct a new DetonationResolver object
+                 *
+                 */
+                DetonationResolver();
+                /**
+                 * @brief Destroy the DetonationResolver object
+                 *
+                 */
+                ~DetonationResolver();
+                /**
+                 * @brief Expand the chain reactions of the triggered bombs
+                 *
+                 * Nothing is modified, the results are read with getDetonated, getFlameTiles and getBurnt.
+                 *
+                 * @param entities Entities of the world
+                 * @param triggered Bombs whose fuse ended
+                 */
+                void resolve(std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities,
+                    std::span<indie::ecs::entity::Entity *const> triggered);
+                /**
+                 * @brief Get the bombs exploding this tick
+                 *
+                 * @return const std::vector<indie::ecs::entity::Entity *>& Triggered and chained bombs, in blast order
+                 */
+                const std::vector<indie::ecs::entity::Entity *> &getDetonated() const;
+                /**
+                 * @brief Get the tiles reached by the flames
+                 *
+                 * @return const std::vector<int>& Union of the flame tiles, as row * BLAST_GRID_COLUMNS + column
+                 */
+                const std::vector<int> &getFlameTiles() const;
+                /**
+                 * @brief Get the entities standing in the flames, bombs excepted
+                 *
+                 * @return const std::vector<size_t>& Indexes in the entities vector, in increasing order
+                 */
+                const std::vector<size_t> &getBurnt() const;
+                /**
+                 * @brief Get the tile under a world position
+                 *
+                 * @param x World x
+                 * @param y World y
+                 * @return int Tile index, -1 outside of the grid
+                 */
+                static int getTile(float x, float y);
+
+              protected:
+              private:
+                /**
+                 * @brief Bucket the entities the flames interact with by tile
+                 *
+                 * @param entities Entities of the world
+                 */
+                void indexEntities(std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities);
+                /**
+                 * @brief Cast the four rays of a bomb
+                 *
+                 * @param entities Entities of the world
+                 * @param bomb Index of the bomb
+                 */
+                void detonate(std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities, size_t bomb);
+                /**
+                 * @brief Set a tile on fire, queuing the bombs lying on it
+                 *
+                 * @param entities Entities of the world
+                 * @param tile Tile index
+                 */
+                void burn(std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities, int tile);
+                /**
+                 * @brief Queue a bomb, once
+                 *
+                 * @param bomb Index of the bomb
+                 */
+                void enqueue(size_t bomb);
+                /**
+                 * @brief Tell if a tile stops the rays
+                 *
+                 * @param tile Tile index
+                 * @return true If an indestructible entity stands on it
+                 */
+                bool isBlocked(int tile) const;
+
+                /**
+                 * @brief First entity of each tile, -1 for an empty tile
+                 *
+                 */
+                std::vector<int> _head;
+                /**
+                 * @brief Next entity on the same tile, by entity index
+                 *
+                 */
+                std::vector<int> _next;
+                /**
+                 * @brief Tile of each entity, -1 for the entities ignored by the flames
+                 *
+                 */
+                std::vector<int> _tileOf;
+                /**
+                 * @brief Tiles holding an indestructible entity
+                 *
+                 */
+                std::vector<bool> _blocked;
+                /**
+                 * @brief Stamp of the last resolve that burnt each tile
+                 *
+                 */
+                std::vector<std::uint32_t> _burning;
+                /**
+                 * @brief Stamp of the last resolve that queued each entity
+                 *
+                 */
+                std::vector<std::uint32_t> _queued;
+                /**
+                 * @brief Current resolve stamp, it spares clearing the marks
+                 *
+                 */
+                std::uint32_t _stamp;
+                /**
+                 * @brief Bombs to expand, indexes in the entities vector
+                 *
+                 */
+                std::vector<size_t> _queue;
+                /**
+                 * @brief Exploding bombs
+                 *
+                 */
+                std::vector<indie::ecs::entity::Entity *> _detonated;
+                /**
+                 * @brief Flame tiles
+                 *
+                 */
+                std::vector<int> _flames;
+                /**
+                 * @brief Entities in the flames
+                 *
+                 */
+                std::vector<size_t> _burnt;
+            };
+        } // namespace system
+    }     // namespace ecs
+} // namespace indie
+
+#endif /* !DETONATIONRESOLVER_HPP_ */
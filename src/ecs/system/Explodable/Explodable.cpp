@@ -10,9 +10,12 @@
  */
 
 #include "Explodable.hpp"
+#include <algorithm>
 #include <cmath>
+#include "../../../save/Journal.hpp"
+#include "../../../tools/FrameArena.hpp"
 
-indie::ecs::system::Explodable::Explodable()
+indie::ecs::system::Explodable::Explodable() : _journal(nullptr), _nextFuse(0)
 {
 }
 
@@ -20,275 +23,197 @@ indie::ecs::system::Explodable::~Explodable()
 {
 }
 
-float indie::ecs::system::Explodable::getValue(float position, float index, char operand)
+void indie::ecs::system::Explodable::setJournal(indie::save::Journal *journal)
 {
-    while (1) {
-        float test = std::fmod(static_cast<float>(position), 2.0f);
-        if (test >= 0.01 || test <= -0.01) {
-            if (operand == '+') {
-                position += 0.01f;
-            } else {
-                position -= 0.01f;
-            }
-        } else {
-            break;
-        }
-    }
-    return (position);
+    this->_journal = journal;
 }
 
-float indie::ecs::system::Explodable::getNewValue(float bombPos)
+void indie::ecs::system::Explodable::flush(std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities)
 {
-    float position = 0.0;
-    float position2 = 0.0;
-    float newPosition = bombPos;
-    if (std::fmod(bombPos, 0.5f) != 0.0) {
-        position = getValue(bombPos, 0.5, '+');
-        position2 = getValue(bombPos, -0.5, '-');
-        float f;
-        float f2;
-        f2 = std::modf(position, &f);
-        if (std::abs(f2) <= 0.1) {
-            position = position - f2;
-        }
-        f2 = std::modf(position2, &f);
-        if (std::abs(f2) <= 0.1) {
-            position2 = position2 - f2;
-        }
-        if ((std::abs(bombPos - position)) < (std::abs(bombPos - position2))) {
-            newPosition = position;
-        } else {
-            newPosition = position2;
-        }
-    }
-    return (newPosition);
-}
+    size_t write = 0;
 
-std::map<size_t, indie::ecs::entity::Entity *> indie::ecs::system::Explodable::getEntityByPosition(
-    std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities, float x, float y)
-{
-    size_t count = 0;
-    std::map<size_t, indie::ecs::entity::Entity *> map;
-    for (auto &entity : entities) {
-        if (entity->hasCompoType(indie::ecs::component::TRANSFORM) == true
-            && entity->hasCompoType(indie::ecs::component::COLLECTABLE) == false) {
-            if (entity->hasCompoType(indie::ecs::component::ALIVE)
-                && entity->getComponent<indie::ecs::component::Alive>(indie::ecs::component::ALIVE)->getAlive()
-                    == false) {
-                continue;
-            }
-            auto transformCompo =
-                entity->getComponent<indie::ecs::component::Transform>(indie::ecs::component::TRANSFORM);
-            float xPosition = getNewValue(transformCompo->getX());
-            float yPosition = getNewValue(transformCompo->getY());
-            if (xPosition == x && yPosition == y) {
-                map.emplace(count, entity.get());
-                return (map);
-            }
+    if (this->_removed.empty())
+        return;
+    for (size_t read = 0; read < entities.size(); read++) {
+        auto &entity = entities[read];
+        // A bonus collected by a player in the same tick is gone already, it is not found here
+        if (std::find(this->_removed.begin(), this->_removed.end(), entity.get()) != this->_removed.end()) {
+            if (this->_journal != nullptr) {
+                auto transformCompo =
+                    entity->getComponent<indie::ecs::component::Transform>(indie::ecs::component::TRANSFORM);
+                if (entity->getEntityType() == indie::ecs::entity::BOXES)
+                    this->_journal->tileChanged(
+                        entity->getEntityType(), transformCompo->getX(), transformCompo->getY());
+                else
+                    this->_journal->entityDestroyed(
+                        entity->getEntityType(), transformCompo->getX(), transformCompo->getY());
+            }
+            continue;
         }
-        count++;
+        if (write != read)
+            entities[write] = std::move(entity);
+        write++;
     }
-    return (map);
+    entities.resize(write);
+    this->_removed.clear();
 }
 
-void indie::ecs::system::Explodable::destroyBoxes(std::vector<int> &compoToRemove,
+void indie::ecs::system::Explodable::detonate(
     std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities,
-    indie::ecs::component::Explodable *explodableCompo, indie::ecs::component::Transform *bombTransformCompo)
+    std::span<indie::ecs::entity::Entity *const> triggered)
 {
-    float xPosition = getNewValue(bombTransformCompo->getX());
-    float yPosition = getNewValue(bombTransformCompo->getY());
+    indie::tools::FrameVector<std::uint32_t> fuses;
 
-    for (float i = 0, counter = 0.0; i < explodableCompo->getRange() + 2.0f; i += 2.0, counter += 2.0) {
-        std::map<size_t, indie::ecs::entity::Entity *> entityMap;
-        entityMap = getEntityByPosition(entities, (xPosition - i), yPosition);
-        if (entityMap.empty() == false) {
-            size_t index = entityMap.begin()->first;
-            indie::ecs::entity::Entity *entity = entityMap.begin()->second;
-            if (entity->hasCompoType(indie::ecs::component::EXPLODABLE)) {
-                continue;
-            }
-            auto transformCompo =
-                entity->getComponent<indie::ecs::component::Transform>(indie::ecs::component::TRANSFORM);
-            float entityXPosition = getNewValue(transformCompo->getX());
-            float entityYPosition = getNewValue(transformCompo->getY());
-            if ((entityXPosition >= xPosition + (-i - 2.0) && entityXPosition <= xPosition)
-                && entityYPosition == yPosition) {
-                entity->getComponent<indie::ecs::component::Destroyable>(indie::ecs::component::DESTROYABLE);
-                if (entity->hasCompoType(indie::ecs::component::DESTROYABLE) == true) {
-                    compoToRemove.push_back(index);
-                } else {
-                    break;
-                }
-            }
-        }
-    }
-    size_t count = 0;
-    for (auto &index : compoToRemove) {
-        auto type = entities.at(index - count)->getEntityType();
-        if (type == indie::ecs::entity::PLAYER_1 || type == indie::ecs::entity::PLAYER_2
-            || type == indie::ecs::entity::PLAYER_3 || type == indie::ecs::entity::PLAYER_4) {
-            entities.at(index - count)
-                ->getComponent<indie::ecs::component::Alive>(indie::ecs::component::ALIVE)
-                ->setAlive(false);
-        } else {
-            if (entities.at(index - count)->hasCompoType(indie::ecs::component::DESTROYABLE) == true) {
-                entities.erase(entities.begin() + index - count);
-            }
-        }
-    }
-    compoToRemove.clear();
-    for (float i = 0, counter = 0.0; i < explodableCompo->getRange() + 2.0f; i += 2.0, counter += 2.0) {
-        std::map<size_t, indie::ecs::entity::Entity *> entityMap;
-        entityMap = getEntityByPosition(entities, (xPosition + i), yPosition);
-        if (entityMap.empty() == false) {
-            size_t index = entityMap.begin()->first;
-            indie::ecs::entity::Entity *entity = entityMap.begin()->second;
-            if (entity->hasCompoType(indie::ecs::component::EXPLODABLE)) {
-                continue;
-            }
-            auto transformCompo =
-                entity->getComponent<indie::ecs::component::Transform>(indie::ecs::component::TRANSFORM);
-            float entityXPosition = getNewValue(transformCompo->getX());
-            float entityYPosition = getNewValue(transformCompo->getY());
-            if ((entityXPosition <= xPosition + (i + 2.0) && entityXPosition >= xPosition)
-                && entityYPosition == yPosition) {
-                entity->getComponent<indie::ecs::component::Destroyable>(indie::ecs::component::DESTROYABLE);
-                if (entity->hasCompoType(indie::ecs::component::DESTROYABLE) == true) {
-                    compoToRemove.push_back(index);
-                } else {
-                    break;
-                }
-            }
-        }
-    }
-    count = 0;
-    for (auto &index : compoToRemove) {
-        auto type = entities.at(index - count)->getEntityType();
-        if (type == indie::ecs::entity::PLAYER_1 || type == indie::ecs::entity::PLAYER_2
-            || type == indie::ecs::entity::PLAYER_3 || type == indie::ecs::entity::PLAYER_4) {
-            entities.at(index - count)
-                ->getComponent<indie::ecs::component::Alive>(indie::ecs::component::ALIVE)
-                ->setAlive(false);
-        } else {
-            if (entities.at(index - count)->hasCompoType(indie::ecs::component::DESTROYABLE) == true) {
-                entities.erase(entities.begin() + index - count);
-                count++;
-            }
-        }
-    }
-    compoToRemove.clear();
-    for (float i = 0, counter = 0.0; i < explodableCompo->getRange() + 2.0f; i += 2.0, counter += 2.0) {
-        std::map<size_t, indie::ecs::entity::Entity *> entityMap;
-        entityMap = getEntityByPosition(entities, xPosition, yPosition + i);
-        if (entityMap.empty() == false) {
-            size_t index = entityMap.begin()->first;
-            indie::ecs::entity::Entity *entity = entityMap.begin()->second;
-            if (entity->hasCompoType(indie::ecs::component::EXPLODABLE)) {
-                continue;
-            }
-            auto transformCompo =
-                entity->getComponent<indie::ecs::component::Transform>(indie::ecs::component::TRANSFORM);
-            float entityXPosition = getNewValue(transformCompo->getX());
-            float entityYPosition = getNewValue(transformCompo->getY());
-            if ((entityYPosition <= yPosition + (i + 2.0) && entityYPosition >= yPosition)
-                && entityXPosition == xPosition) {
-                entity->getComponent<indie::ecs::component::Destroyable>(indie::ecs::component::DESTROYABLE);
-                if (entity->hasCompoType(indie::ecs::component::DESTROYABLE) == true) {
-                    compoToRemove.push_back(index);
-                } else {
-                    break;
-                }
-            }
-        }
-    }
-    for (auto &index : compoToRemove) {
-        auto type = entities.at(index - count)->getEntityType();
-        if (type == indie::ecs::entity::PLAYER_1 || type == indie::ecs::entity::PLAYER_2
-            || type == indie::ecs::entity::PLAYER_3 || type == indie::ecs::entity::PLAYER_4) {
-            entities.at(index - count)
-                ->getComponent<indie::ecs::component::Alive>(indie::ecs::component::ALIVE)
-                ->setAlive(false);
-        } else {
-            if (entities.at(index - count)->hasCompoType(indie::ecs::component::DESTROYABLE) == true) {
-                entities.erase(entities.begin() + index);
-            }
-        }
-    }
-    compoToRemove.clear();
-    for (float i = 0, counter = 0.0; i < explodableCompo->getRange() + 2.0f; i += 2.0, counter += 2.0) {
-        std::map<size_t, indie::ecs::entity::Entity *> entityMap;
-        entityMap = getEntityByPosition(entities, xPosition, yPosition - i);
-        if (entityMap.empty() == false) {
-            size_t index = entityMap.begin()->first;
-            indie::ecs::entity::Entity *entity = entityMap.begin()->second;
-            if (entity->hasCompoType(indie::ecs::component::EXPLODABLE)) {
-                continue;
-            }
-            auto transformCompo =
-                entity->getComponent<indie::ecs::component::Transform>(indie::ecs::component::TRANSFORM);
-            float entityXPosition = getNewValue(transformCompo->getX());
-            float entityYPosition = getNewValue(transformCompo->getY());
-            if ((entityYPosition >= yPosition + (-i - 2.0) && entityYPosition <= yPosition)
-                && (entityXPosition >= xPosition)) {
-                if (entity->hasCompoType(indie::ecs::component::DESTROYABLE) == true) {
-                    compoToRemove.push_back(index);
-                } else {
-                    break;
-                }
-            }
-        }
+    this->_resolver.resolve(entities, triggered);
+    this->_flames.ignite(this->_resolver.getFlameTiles());
+    for (auto &bomb : this->_resolver.getDetonated()) {
+        auto explodableCompo = bomb->getComponent<ecs::component::Explodable>(ecs::component::compoType::EXPLODABLE);
+        // A chained bomb goes off now, its own fuse is ignored when it ends
+        this->_armed.erase(explodableCompo->getFuseId());
+        fuses.push_back(explodableCompo->getFuseId());
+        // It was never seen exploding, its blast is kept for the sounds
+        auto transformCompo = bomb->getComponent<ecs::component::Transform>(ecs::component::compoType::TRANSFORM);
+        int tile = transformCompo == nullptr
+            ? -1
+            : indie::ecs::system::DetonationResolver::getTile(transformCompo->getX(), transformCompo->getY());
+        if (!explodableCompo->getExplode() && tile >= 0)
+            this->_chained.push_back(tile);
+        explodableCompo->setExplode(true);
+        explodableCompo->setExploded(true);
     }
-    count = 0;
-    for (auto &index : compoToRemove) {
-        auto type = entities.at(index - count)->getEntityType();
-        if (type == indie::ecs::entity::PLAYER_1 || type == indie::ecs::entity::PLAYER_2
-            || type == indie::ecs::entity::PLAYER_3 || type == indie::ecs::entity::PLAYER_4) {
-            entities.at(index - count)
-                ->getComponent<indie::ecs::component::Alive>(indie::ecs::component::ALIVE)
-                ->setAlive(false);
-        } else {
-            if (entities.at(index - count)->hasCompoType(indie::ecs::component::DESTROYABLE) == true) {
-                entities.erase(entities.begin() + index - count);
-                count++;
-            }
-        }
+    this->_danger.removeBombs(fuses);
+    for (auto &index : this->_resolver.getBurnt()) {
+        auto &entity = entities[index];
+        if (entity->hasCompoType(indie::ecs::component::ALIVE))
+            entity->getComponent<indie::ecs::component::Alive>(indie::ecs::component::ALIVE)->setAlive(false);
+        else
+            this->_removed.push_back(entity.get());
     }
-    compoToRemove.clear();
 }
 
 void indie::ecs::system::Explodable::update(std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities)
 {
-    std::vector<int> compoToRemove;
-    std::vector<indie::ecs::entity::Entity *> bombVector;
+    this->_flames.tick();
+    this->_chained.clear();
+    // Copied out rather than swapped, so _lit keeps its capacity for the fuses ending below
+    indie::tools::FrameVector<indie::ecs::entity::Entity *> exploding(this->_lit.begin(), this->_lit.end());
+    this->_lit.clear();
+    exploding.erase(std::remove_if(exploding.begin(), exploding.end(),
+                        [](indie::ecs::entity::Entity *entity) {
+                            return (!entity
+                                         ->getComponent<ecs::component::Explodable>(
+                                             ecs::component::compoType::EXPLODABLE)
+                                         ->getDropped());
+                        }),
+        exploding.end());
+    if (!exploding.empty())
+        detonate(entities, exploding);
+    this->_fuses.advance([this](std::uint32_t fuse) {
+        auto armed = this->_armed.find(fuse);
+        if (armed == this->_armed.end())
+            return;
+        armed->second->getComponent<ecs::component::Explodable>(ecs::component::compoType::EXPLODABLE)
+            ->setExplode(true);
+        this->_lit.push_back(armed->second);
+        this->_armed.erase(armed);
+    });
+}
 
-    for (auto &entity : entities) {
-        if (entity->hasCompoType(indie::ecs::component::compoType::EXPLODABLE) == true) {
-            bombVector.push_back(entity.get());
-        }
+void indie::ecs::system::Explodable::arm(indie::ecs::entity::Entity *bomb, std::uint32_t fuseTicks)
+{
+    auto explodableCompo = bomb->getComponent<ecs::component::Explodable>(ecs::component::compoType::EXPLODABLE);
+
+    if (explodableCompo == nullptr)
+        return;
+    if (++this->_nextFuse == 0)
+        this->_nextFuse = 1;
+    explodableCompo->setFuseId(this->_nextFuse);
+    if (explodableCompo->getExplode()) {
+        explodableCompo->setDetonationTick(this->_fuses.now());
+        this->_lit.push_back(bomb);
+    } else {
+        explodableCompo->setDetonationTick(this->_fuses.now() + (fuseTicks == 0 ? 1 : fuseTicks));
+        this->_armed[this->_nextFuse] = bomb;
+        this->_fuses.schedule(explodableCompo->getDetonationTick(), this->_nextFuse);
     }
-    for (auto &entity : bombVector) {
-        if (entity->hasCompoType(indie::ecs::component::compoType::EXPLODABLE) == true) {
-            auto explodableCompo =
-                entity->getComponent<ecs::component::Explodable>(ecs::component::compoType::EXPLODABLE);
-            if (explodableCompo->getDropped() == true) {
-                if (explodableCompo->getExplode() == true) {
-                    explodableCompo->setExploded(true);
-                    destroyBoxes(compoToRemove, entities, explodableCompo,
-                        entity->getComponent<ecs::component::Transform>(indie::ecs::component::compoType::TRANSFORM));
-                } else {
-                    auto t_now = std::chrono::system_clock::now();
-                    std::chrono::seconds elapsed =
-                        std::chrono::duration_cast<std::chrono::seconds>(t_now - explodableCompo->getTStart());
-                    if (explodableCompo->getSeconds() <= elapsed) {
-                        explodableCompo->setExplode(true);
-                    }
-                }
-            }
+    auto transformCompo = bomb->getComponent<ecs::component::Transform>(ecs::component::compoType::TRANSFORM);
+    if (transformCompo != nullptr)
+        this->_danger.addBomb(this->_nextFuse,
+            indie::ecs::system::DetonationResolver::getTile(transformCompo->getX(), transformCompo->getY()),
+            static_cast<int>(std::ceil(explodableCompo->getRange() / BLAST_TILE_SIZE)),
+            explodableCompo->getDetonationTick());
+}
+
+void indie::ecs::system::Explodable::disarm(indie::ecs::entity::Entity *bomb)
+{
+    auto explodableCompo = bomb->getComponent<ecs::component::Explodable>(ecs::component::compoType::EXPLODABLE);
+
+    if (explodableCompo != nullptr) {
+        this->_armed.erase(explodableCompo->getFuseId());
+        this->_danger.removeBomb(explodableCompo->getFuseId());
+    }
+    for (auto it = this->_lit.begin(); it != this->_lit.end(); ++it) {
+        if (*it == bomb) {
+            this->_lit.erase(it);
+            break;
         }
     }
 }
 
+std::uint32_t indie::ecs::system::Explodable::getRemainingTicks(
+    const indie::ecs::component::Explodable *bomb) const
+{
+    if (bomb->getExplode() || bomb->getDetonationTick() <= this->_fuses.now())
+        return (0);
+    return (static_cast<std::uint32_t>(bomb->getDetonationTick() - this->_fuses.now()));
+}
+
+void indie::ecs::system::Explodable::reset()
+{
+    this->_fuses.clear();
+    this->_armed.clear();
+    this->_lit.clear();
+    this->_chained.clear();
+    this->_removed.clear();
+    this->_flames.clear();
+    this->_danger.clear();
+}
+
+const std::vector<int> &indie::ecs::system::Explodable::getChained() const
+{
+    return (this->_chained);
+}
+
+indie::board::FlameField &indie::ecs::system::Explodable::getFlameField()
+{
+    return (this->_flames);
+}
+
+indie::board::DangerMap &indie::ecs::system::Explodable::getDangerMap()
+{
+    return (this->_danger);
+}
+
+std::uint64_t indie::ecs::system::Explodable::getTick() const
+{
+    return (this->_fuses.now());
+}
+
 indie::ecs::system::SystemType indie::ecs::system::Explodable::getSystemType() const
 {
     return (indie::ecs::system::SystemType::EXPLODABLESYSTEM);
-}
\ No newline at end of file
+}
+
+indie::ecs::system::Access indie::ecs::system::Explodable::getAccess() const
+{
+    indie::ecs::system::Access access = {};
+
+    // The burnt entities unload their textures and models when erased, flush does it on the main thread
+    access.reads = componentBit(component::TRANSFORM) | componentBit(component::EXPLODABLE)
+        | componentBit(component::ALIVE) | componentBit(component::COLLIDE) | componentBit(component::COLLECTABLE)
+        | componentBit(component::DESTROYABLE);
+    access.writes = componentBit(component::EXPLODABLE) | componentBit(component::ALIVE);
+    access.structural = false;
+    access.mainThread = false;
+    return (access);
+}
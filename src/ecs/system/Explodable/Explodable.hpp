@@ -12,11 +12,22 @@
 #ifndef EXPLODABLE_HPP_
 #define EXPLODABLE_HPP_
 
-#include <map>
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+#include "../../../board/DangerMap.hpp"
+#include "../../../board/FlameField.hpp"
+#include "../../../tools/TimerWheel.hpp"
 #include "../ISystem.hpp"
+#include "DetonationResolver.hpp"
 
 namespace indie
 {
+    namespace save
+    {
+        class Journal;
+    } // namespace save
     namespace ecs
     {
         namespace system
@@ -35,39 +46,153 @@ namespace indie
                  */
                 ~Explodable();
                 /**
-                 * @brief Update explodable entities
+                 * @brief Move the fuse clock one tick forward, explode the bombs whose fuse ended last tick and light
+                 * the ones whose fuse ends now
+                 *
+                 * Only the bombs concerned are touched, the others wait in the timer wheel. The bombs caught in the
+                 * flames explode in the same tick, and their flames stay in the flame field for FLAME_TICKS ticks.
+                 * The entities burnt are left for flush, nothing is erased here.
                  *
                  * @param entities Entity to update
                  */
                 void update(std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities);
-                /**
-                 * @brief Destroy the boxes on the map
-                 *
-                 * @param compoToRemove Component to be removed
-                 * @param entities Entity to be removed
-                 * @param explodableCompo Explodable component
-                 * @param transformCompo Transform component
-                 */
-                void destroyBoxes(std::vector<int> &compoToRemove,
-                    std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities,
-                    indie::ecs::component::Explodable *explodableCompo,
-                    indie::ecs::component::Transform *transformCompo);
-
-                float getValue(float position, float index, char operand);
-                float getNewValue(float bombPos);
-
-                std::map<size_t, indie::ecs::entity::Entity *> getEntityByPosition(
-                    std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities, float x, float y);
-
                 /**
                  * @brief Get the System Type object
                  *
                  * @return indie::ecs::system::SystemType SystemType
                  */
                 indie::ecs::system::SystemType getSystemType() const;
+                /**
+                 * @brief Get what the system touches
+                 *
+                 * @return indie::ecs::system::Access Components read and written
+                 */
+                indie::ecs::system::Access getAccess() const;
+                /**
+                 * @brief Set the journal receiving the destroyed entities
+                 *
+                 * @param journal Autosave journal, nullptr to disable journaling
+                 */
+                void setJournal(indie::save::Journal *journal);
+                /**
+                 * @brief Erase the entities burnt during the last update in a single compaction, journaling their
+                 * removal
+                 *
+                 * @param entities Vector of entities
+                 */
+                void flush(std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities);
+                /**
+                 * @brief Light the fuse of a bomb, a bomb already exploding explodes at the next update
+                 *
+                 * @param bomb Entity with an Explodable component, it must stay alive until it explodes or is disarmed
+                 * @param fuseTicks Ticks before the bomb explodes
+                 */
+                void arm(indie::ecs::entity::Entity *bomb, std::uint32_t fuseTicks);
+                /**
+                 * @brief Cancel the fuse of a bomb about to be destroyed
+                 *
+                 * @param bomb Entity given to arm
+                 */
+                void disarm(indie::ecs::entity::Entity *bomb);
+                /**
+                 * @brief Get the ticks left before a bomb explodes
+                 *
+                 * @param bomb Armed bomb
+                 * @return std::uint32_t Ticks left, 0 if it is exploding
+                 */
+                std::uint32_t getRemainingTicks(const indie::ecs::component::Explodable *bomb) const;
+                /**
+                 * @brief Cancel every fuse, put out the flames and clear the danger map, before the bombs are destroyed
+                 *
+                 */
+                void reset();
+                /**
+                 * @brief Get the tiles of the bombs set off by another one during the last update
+                 *
+                 * They explode without going through the lit state, so nothing else tells they went off.
+                 *
+                 * @return const std::vector<int>& Tiles of the chained bombs
+                 */
+                const std::vector<int> &getChained() const;
+                /**
+                 * @brief Get the flames left by the explosions
+                 *
+                 * @return indie::board::FlameField& The flame field
+                 */
+                indie::board::FlameField &getFlameField();
+                /**
+                 * @brief Get the earliest detonation tick of each tile, updated on each bomb event
+                 *
+                 * @return indie::board::DangerMap& The danger map, its ticks are compared to getTick
+                 */
+                indie::board::DangerMap &getDangerMap();
+                /**
+                 * @brief Get the fuse clock
+                 *
+                 * @return std::uint64_t Current tick, a bomb explodes at the update starting on its detonation tick
+                 */
+                std::uint64_t getTick() const;
 
               protected:
               private:
+                /**
+                 * @brief Explode the triggered bombs and the bombs they chain, then apply the damage in one pass
+                 *
+                 * @param entities Vector of entities
+                 * @param triggered Bombs whose fuse ended
+                 */
+                void detonate(std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities,
+                    std::span<indie::ecs::entity::Entity *const> triggered);
+                /**
+                 * @brief Autosave journal
+                 *
+                 */
+                indie::save::Journal *_journal;
+                /**
+                 * @brief Fuses by detonation tick, the wheel is advanced once per update
+                 *
+                 */
+                indie::tools::TimerWheel<std::uint32_t> _fuses;
+                /**
+                 * @brief Armed bombs by fuse id, a fuse whose bomb is gone is ignored
+                 *
+                 */
+                std::unordered_map<std::uint32_t, indie::ecs::entity::Entity *> _armed;
+                /**
+                 * @brief Next fuse id, 0 is never used
+                 *
+                 */
+                std::uint32_t _nextFuse;
+                /**
+                 * @brief Bombs lit during the last update, they explode at the next one
+                 *
+                 */
+                std::vector<indie::ecs::entity::Entity *> _lit;
+                /**
+                 * @brief Tiles of the bombs chained during the last update
+                 *
+                 */
+                std::vector<int> _chained;
+                /**
+                 * @brief Entities burnt during the last update, erased by flush
+                 *
+                 */
+                std::vector<indie::ecs::entity::Entity *> _removed;
+                /**
+                 * @brief Chain reaction resolver, kept to reuse its buffers
+                 *
+                 */
+                indie::ecs::system::DetonationResolver _resolver;
+                /**
+                 * @brief Flames left by the explosions
+                 *
+                 */
+                indie::board::FlameField _flames;
+                /**
+                 * @brief Earliest detonation tick of each tile
+                 *
+                 */
+                indie::board::DangerMap _danger;
             };
         } // namespace system
     }     // namespace ecs
@@ -12,6 +12,7 @@
 #ifndef SYSTEM_HPP_
 #define SYSTEM_HPP_
 
+#include <cstdint>
 #include "../component/IComponent.hpp"
 #include "../entity/Entity.hpp"
 
@@ -32,7 +33,29 @@ namespace indie
                 COLLIDESYSTEM,
                 SOUNDSYSTEM,
                 EXPLODABLESYSTEM,
-                OBJECTSYSTEM
+                OBJECTSYSTEM,
+                INPUTSYSTEM
+            };
+            /**
+             * @brief Mask bit of a component type in an Access
+             *
+             * @param type Component type
+             * @return std::uint32_t The bit
+             */
+            constexpr std::uint32_t componentBit(indie::ecs::component::compoType type)
+            {
+                return (std::uint32_t(1) << type);
+            }
+            /// @brief What a system touches, two systems run concurrently when their accesses do not conflict
+            struct Access {
+                /// @brief componentBit of each component type read
+                std::uint32_t reads;
+                /// @brief componentBit of each component type written
+                std::uint32_t writes;
+                /// @brief Whether the update creates or erases entities, which conflicts with every other system
+                bool structural;
+                /// @brief Whether it calls raylib drawing or loading functions, only allowed on the main thread
+                bool mainThread;
             };
             /// @brief System
             class ISystem {
@@ -55,6 +78,27 @@ namespace indie
                  * @return enum value correspond to the type of system
                  */
                 virtual indie::ecs::system::SystemType getSystemType() const = 0;
+                /**
+                 * @brief Get what the system touches, by default everything on the main thread
+                 *
+                 * @return indie::ecs::system::Access Components read and written
+                 */
+                virtual indie::ecs::system::Access getAccess() const
+                {
+                    return {~std::uint32_t(0), ~std::uint32_t(0), true, true};
+                }
+                /**
+                 * @brief Erase the entities the last update left for removal, on the main thread once every system
+                 * of the tick ran
+                 *
+                 * A system deferring its removals this way is not structural, its update can run on a worker.
+                 *
+                 * @param entities vector of entites the update ran on
+                 */
+                virtual void flush(std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities)
+                {
+                    (void)entities;
+                }
 
               private:
             };
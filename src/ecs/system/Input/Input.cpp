@@ -0,0 +1,133 @@
+/**
+ * @file Input.cpp
+ * @brief Input system source file
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "Input.hpp"
+
+indie::ecs::system::InputSystem::InputSystem(std::vector<player::Player> *players)
+    : _players(players), _handles(), _commands(), _event()
+{
+}
+
+indie::ecs::system::InputSystem::~InputSystem()
+{
+}
+
+void indie::ecs::system::InputSystem::bindPlayer(indie::ecs::entity::Entity *entity)
+{
+    auto control = entity->getComponent<indie::ecs::component::PlayerControl>(indie::ecs::component::PLAYERCONTROL);
+
+    if (control == nullptr || control->getPlayer() < 0 || control->getPlayer() >= MAX_PLAYERS)
+        return;
+    if (control->getPlayer() >= static_cast<int>(this->_handles.size()))
+        this->_handles.resize(control->getPlayer() + 1, Handle());
+    this->_handles[control->getPlayer()] = {entity, control,
+        entity->getComponent<indie::ecs::component::Transform>(indie::ecs::component::TRANSFORM),
+        entity->getComponent<indie::ecs::component::Object>(indie::ecs::component::ANIMATED)};
+}
+
+void indie::ecs::system::InputSystem::unbindPlayers()
+{
+    this->_handles.clear();
+}
+
+const indie::ecs::system::InputSystem::Handle &indie::ecs::system::InputSystem::getHandle(int player) const
+{
+    static const Handle unbound = {nullptr, nullptr, nullptr, nullptr};
+
+    if (player < 0 || player >= static_cast<int>(this->_handles.size()))
+        return (unbound);
+    return (this->_handles[player]);
+}
+
+int indie::ecs::system::InputSystem::getHandleCount() const
+{
+    return (static_cast<int>(this->_handles.size()));
+}
+
+void indie::ecs::system::InputSystem::setEvent(const indie::Event &event)
+{
+    this->_event = event;
+}
+
+void indie::ecs::system::InputSystem::setCommand(int player, const Command &command)
+{
+    if (player < 0 || player >= MAX_PLAYERS)
+        return;
+    if (player >= static_cast<int>(this->_commands.size()))
+        this->_commands.resize(player + 1, {indie::Event::JOYSTICK_NONE, false});
+    this->_commands[player] = command;
+}
+
+void indie::ecs::system::InputSystem::move(
+    const Handle &handle, indie::Event::JoystickDirection direction, float speed)
+{
+    float step = speed / 50.0f;
+
+    switch (direction) {
+        case indie::Event::DOWN:
+            handle.transform->setSpeedX(0);
+            handle.transform->setSpeedY(step);
+            handle.object->setOrientation(indie::ecs::component::Object::SOUTH);
+            break;
+        case indie::Event::UP:
+            handle.transform->setSpeedX(0);
+            handle.transform->setSpeedY(-step);
+            handle.object->setOrientation(indie::ecs::component::Object::NORTH);
+            break;
+        case indie::Event::LEFT:
+            handle.transform->setSpeedX(-step);
+            handle.transform->setSpeedY(0);
+            handle.object->setOrientation(indie::ecs::component::Object::WEST);
+            break;
+        case indie::Event::RIGHT:
+            handle.transform->setSpeedX(step);
+            handle.transform->setSpeedY(0);
+            handle.object->setOrientation(indie::ecs::component::Object::EAST);
+            break;
+        default: return;
+    }
+    handle.object->setAnimationsCounter(handle.object->getAnimationsCounter() + 5);
+    raylib::Model::updateModelAnimation(
+        handle.object->getModel(), handle.object->getAnimations()[0], handle.object->getAnimationsCounter());
+    if (handle.object->getAnimationsCounter() >= handle.object->getAnimations()[0].frameCount)
+        handle.object->setAnimationsCounter(0);
+}
+
+void indie::ecs::system::InputSystem::update(std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities)
+{
+    (void)entities;
+    for (size_t i = 0; i < this->_handles.size() && i < this->_players->size(); i++) {
+        const Handle &handle = this->_handles[i];
+        const player::Player &player = this->_players->at(i);
+
+        if (handle.entity == nullptr)
+            continue;
+        handle.control->setBombRequested(false);
+        if (!player.getIsPlaying() || !player.getIsAlive())
+            continue;
+        Command command = {indie::Event::JOYSTICK_NONE, false};
+        if (player.getIsBot()) {
+            if (i < this->_commands.size())
+                command = this->_commands[i];
+        } else if (player.getControllerId() < EVENT_CONTROLLERS) {
+            const indie::Event::ControllerEvent &controller = this->_event.controller[player.getControllerId()];
+            command = {controller.leftJoystick, controller.code == indie::Event::X_BUTTON};
+        }
+        handle.control->setDirection(command.direction);
+        if (handle.transform != nullptr && handle.object != nullptr)
+            move(handle, command.direction, static_cast<float>(player.getSpeed()));
+        handle.control->setBombRequested(command.bomb);
+    }
+}
+
+indie::ecs::system::SystemType indie::ecs::system::InputSystem::getSystemType() const
+{
+    return (indie::ecs::system::SystemType::INPUTSYSTEM);
+}
@@ -0,0 +1,143 @@
+/**
+ * @file Input.hpp
+ * @brief Input system header file
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef INPUT_HPP_
+#define INPUT_HPP_
+
+#include <vector>
+#include "../../../player/Player.hpp"
+#include "../ISystem.hpp"
+#include "events.hpp"
+
+namespace indie
+{
+    namespace ecs
+    {
+        namespace system
+        {
+            /// @brief Input system, turns the drained controller state and the bot commands into player velocity,
+            /// orientation and bombs
+            class InputSystem : public ISystem {
+              public:
+                /// @brief Components of a player entity, resolved once when the entity is bound
+                struct Handle {
+                    /// @brief Player entity
+                    indie::ecs::entity::Entity *entity;
+                    /// @brief Its PlayerControl component
+                    indie::ecs::component::PlayerControl *control;
+                    /// @brief Its Transform component
+                    indie::ecs::component::Transform *transform;
+                    /// @brief Its animated Object component
+                    indie::ecs::component::Object *object;
+                };
+                /// @brief Input of a player driven without a controller
+                struct Command {
+                    /// @brief Stick direction
+                    indie::Event::JoystickDirection direction;
+                    /// @brief Drop a bomb
+                    bool bomb;
+                };
+                /**
+                 * @brief Create new input system.
+                 *
+                 * @param players Players, for their speed and state
+                 */
+                InputSystem(std::vector<player::Player> *players);
+                /**
+                 * @brief Destroy input system.
+                 */
+                ~InputSystem();
+
+                /**
+                 * @brief Bind a player entity, replacing the previous entity of the same player
+                 *
+                 * @param entity Entity owning a PlayerControl component, it must outlive the binding
+                 */
+                void bindPlayer(indie::ecs::entity::Entity *entity);
+                /**
+                 * @brief Forget every player entity, before they are destroyed
+                 *
+                 */
+                void unbindPlayers();
+                /**
+                 * @brief Get the bound components of a player
+                 *
+                 * @param player Player index
+                 * @return const Handle& The handle, its entity is nullptr when the player is not bound
+                 */
+                const Handle &getHandle(int player) const;
+                /**
+                 * @brief Get the number of player slots, the highest bound player index plus one
+                 *
+                 * @return int Number of handles
+                 */
+                int getHandleCount() const;
+                /**
+                 * @brief Set the input applied by the next update
+                 *
+                 * @param event Drained event
+                 */
+                void setEvent(const indie::Event &event);
+                /**
+                 * @brief Set the input of a bot, applied by the next update instead of its controller
+                 *
+                 * @param player Player index
+                 * @param command Stick direction and bomb button
+                 */
+                void setCommand(int player, const Command &command);
+                /**
+                 * @brief Apply the input to the bound players, the entities are not scanned.
+                 *
+                 * @param entities vector of entities.
+                 */
+                void update(std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities) override;
+
+                /**
+                 * @brief Get the type of system.
+                 *
+                 * @return enum value correspond to the type of system
+                 */
+                indie::ecs::system::SystemType getSystemType() const override;
+
+              private:
+                /**
+                 * @brief Move and animate a player toward a direction
+                 *
+                 * @param handle Player components
+                 * @param direction Direction of the left joystick
+                 * @param speed Speed of the player
+                 */
+                void move(const Handle &handle, indie::Event::JoystickDirection direction, float speed);
+                /**
+                 * @brief Players
+                 *
+                 */
+                std::vector<player::Player> *_players;
+                /**
+                 * @brief Bound player entities, by player index
+                 *
+                 */
+                std::vector<Handle> _handles;
+                /**
+                 * @brief Input of the bots, by player index
+                 *
+                 */
+                std::vector<Command> _commands;
+                /**
+                 * @brief Input applied by the next update
+                 *
+                 */
+                indie::Event _event;
+            };
+        } // namespace system
+    }     // namespace ecs
+} // namespace indie
+
+#endif /* !INPUT_HPP_ */
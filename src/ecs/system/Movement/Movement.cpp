@@ -32,4 +32,15 @@ void indie::ecs::system::MovementSystem::update(std::vector<std::unique_ptr<indi
 indie::ecs::system::SystemType indie::ecs::system::MovementSystem::getSystemType() const
 {
     return (indie::ecs::system::SystemType::MOVEMENTSYSTEM);
-}
\ No newline at end of file
+}
+
+indie::ecs::system::Access indie::ecs::system::MovementSystem::getAccess() const
+{
+    indie::ecs::system::Access access = {};
+
+    access.reads = componentBit(component::TRANSFORM) | componentBit(component::COLLIDE);
+    access.writes = componentBit(component::TRANSFORM);
+    access.structural = false;
+    access.mainThread = false;
+    return (access);
+}
@@ -10,6 +10,7 @@
  */
 
 #include "Object.hpp"
+#include "../../../profiling/FrameStats.hpp"
 
 void indie::ecs::system::ObjectSystem::update(std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities)
 {
@@ -45,6 +46,7 @@ void indie::ecs::system::ObjectSystem::update(std::vector<std::unique_ptr<indie:
             rotationAxis.z = rotationVec.z;
             indie::raylib::Model::drawEx(
                 objectCompo->getModel(), pos, rotationAxis, objectCompo->getOrientation(), scale, WHITE);
+            indie::profiling::FrameStats::countDrawCalls();
         }
     }
 }
@@ -52,4 +54,16 @@ void indie::ecs::system::ObjectSystem::update(std::vector<std::unique_ptr<indie:
 indie::ecs::system::SystemType indie::ecs::system::ObjectSystem::getSystemType() const
 {
     return (indie::ecs::system::SystemType::OBJECTSYSTEM);
-}
\ No newline at end of file
+}
+
+indie::ecs::system::Access indie::ecs::system::ObjectSystem::getAccess() const
+{
+    indie::ecs::system::Access access = {};
+
+    access.reads = componentBit(component::MODEL) | componentBit(component::ANIMATED)
+        | componentBit(component::TRANSFORM) | componentBit(component::ALIVE);
+    access.writes = 0;
+    access.structural = false;
+    access.mainThread = true;
+    return (access);
+}
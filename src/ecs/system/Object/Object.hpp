@@ -48,6 +48,12 @@ namespace indie
                  * @return enum value correspond to the type of system
                  */
                 indie::ecs::system::SystemType getSystemType() const override;
+                /**
+                 * @brief Get what the system touches
+                 *
+                 * @return indie::ecs::system::Access Components read and written
+                 */
+                indie::ecs::system::Access getAccess() const override;
 
               private:
             };
@@ -0,0 +1,82 @@
+/**
+ * @file Scheduler.cpp
+ * @brief System scheduler source file
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "Scheduler.hpp"
+#include "../../../tools/FrameArena.hpp"
+
+indie::ecs::system::Scheduler::Scheduler()
+{
+    this->_rates.fill(indie::ecs::system::EVERY_TICK);
+}
+
+void indie::ecs::system::Scheduler::setRate(
+    indie::ecs::system::SystemType type, const indie::ecs::system::Rate &rate)
+{
+    std::uint32_t period = rate.period > 0 ? rate.period : 1;
+
+    this->_rates[type] = {period, rate.phase % period};
+}
+
+const indie::ecs::system::Rate &indie::ecs::system::Scheduler::getRate(indie::ecs::system::SystemType type) const
+{
+    return (this->_rates[type]);
+}
+
+void indie::ecs::system::Scheduler::run(std::span<indie::ecs::system::ISystem *const> systems, std::uint64_t tick,
+    indie::core::JobSystem *jobs, const Runner &runner) const
+{
+    indie::tools::FrameVector<indie::ecs::system::ISystem *> due;
+    indie::tools::FrameVector<indie::ecs::system::Access> accesses;
+    indie::tools::FrameVector<indie::core::JobSystem::Handle> handles;
+    indie::tools::FrameVector<indie::core::JobSystem::Handle> dependencies;
+
+    due.reserve(systems.size());
+    for (auto system : systems)
+        if (isDue(this->_rates[system->getSystemType()], tick))
+            due.push_back(system);
+    if (jobs == nullptr) {
+        for (auto system : due)
+            runner(*system);
+        return;
+    }
+    accesses.reserve(due.size());
+    handles.reserve(due.size());
+    dependencies.reserve(due.size());
+    for (std::size_t index = 0; index < due.size(); index++) {
+        indie::ecs::system::ISystem *system = due[index];
+        auto job = [&runner, system]() { runner(*system); };
+
+        accesses.push_back(system->getAccess());
+        dependencies.clear();
+        for (std::size_t earlier = 0; earlier < index; earlier++)
+            if (conflicts(accesses[earlier], accesses[index]))
+                dependencies.push_back(handles[earlier]);
+        if (accesses[index].mainThread)
+            handles.push_back(jobs->submitMain(job, dependencies));
+        else
+            handles.push_back(jobs->submit(job, dependencies));
+    }
+    // Waiting on the main thread runs the pinned systems as they become ready
+    for (auto &handle : handles)
+        jobs->wait(handle);
+}
+
+bool indie::ecs::system::Scheduler::isDue(const indie::ecs::system::Rate &rate, std::uint64_t tick)
+{
+    return (rate.period <= 1 || tick % rate.period == rate.phase % rate.period);
+}
+
+bool indie::ecs::system::Scheduler::conflicts(
+    const indie::ecs::system::Access &first, const indie::ecs::system::Access &second)
+{
+    if (first.structural || second.structural)
+        return (true);
+    return ((first.writes & (second.reads | second.writes)) != 0 || (second.writes & first.reads) != 0);
+}
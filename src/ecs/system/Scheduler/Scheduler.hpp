@@ -0,0 +1,110 @@
+/**
+ * @file Scheduler.hpp
+ * @brief System scheduler header file
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef SCHEDULER_HPP_
+#define SCHEDULER_HPP_
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include "../../../core/JobSystem.hpp"
+#include "../ISystem.hpp"
+
+namespace indie
+{
+    namespace ecs
+    {
+        namespace system
+        {
+            /// @brief How often something runs, counted in ticks
+            struct Rate {
+                /// @brief Ticks between two runs, 1 for every tick
+                std::uint32_t period;
+                /// @brief Tick of the period it runs on, spreads the work sharing a period over the ticks
+                std::uint32_t phase;
+            };
+            /// @brief Rate of the simulation, every tick
+            constexpr Rate EVERY_TICK = {1, 0};
+
+            /**
+             * @brief Runs systems concurrently when what they touch allows it
+             *
+             * Each run builds the graph again from the accesses of the systems: a system waits for every earlier one
+             * it conflicts with, so the result is the one of running them in order. Systems pinned to the main thread
+             * run there while it waits for the others.
+             *
+             * Each system type has a rate: the systems not due on a tick are left out of its graph, the others keep
+             * their order.
+             */
+            class Scheduler {
+              public:
+                /// @brief Runs one system, called from the thread the scheduler picked
+                using Runner = std::function<void(indie::ecs::system::ISystem &)>;
+
+                /**
+                 * @brief Construct a new Scheduler object, running every system on every tick
+                 *
+                 */
+                Scheduler();
+                /**
+                 * @brief Set how often the systems of a type run
+                 *
+                 * @param type System type
+                 * @param rate Its rate, a period of 0 is taken as 1
+                 */
+                void setRate(indie::ecs::system::SystemType type, const indie::ecs::system::Rate &rate);
+                /**
+                 * @brief Get how often the systems of a type run
+                 *
+                 * @param type System type
+                 * @return const indie::ecs::system::Rate& Its rate
+                 */
+                const indie::ecs::system::Rate &getRate(indie::ecs::system::SystemType type) const;
+                /**
+                 * @brief Run the systems due on a tick, returning once all of them ran
+                 *
+                 * @param systems Systems, in the order they would run one after the other
+                 * @param tick Current tick
+                 * @param jobs Job system, nullptr to run them in order, otherwise called from the main thread
+                 * @param runner Function running a system
+                 */
+                void run(std::span<indie::ecs::system::ISystem *const> systems, std::uint64_t tick,
+                    indie::core::JobSystem *jobs, const Runner &runner) const;
+                /**
+                 * @brief Check if something running at a rate is due on a tick
+                 *
+                 * @param rate Its rate
+                 * @param tick The tick
+                 * @return true If it runs on that tick
+                 */
+                static bool isDue(const indie::ecs::system::Rate &rate, std::uint64_t tick);
+                /**
+                 * @brief Check if two systems must not run at the same time
+                 *
+                 * @param first Access of a system
+                 * @param second Access of the other system
+                 * @return true If one writes what the other touches, or either creates or erases entities
+                 */
+                static bool conflicts(
+                    const indie::ecs::system::Access &first, const indie::ecs::system::Access &second);
+
+              private:
+                /// @brief Number of system types
+                static constexpr std::size_t SYSTEM_TYPES = indie::ecs::system::INPUTSYSTEM + 1;
+
+                /// @brief Rate of each system type
+                std::array<indie::ecs::system::Rate, SYSTEM_TYPES> _rates;
+            };
+        } // namespace system
+    }     // namespace ecs
+} // namespace indie
+
+#endif /* !SCHEDULER_HPP_ */
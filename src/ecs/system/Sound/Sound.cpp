@@ -10,8 +10,9 @@
  */
 
 #include "Sound.hpp"
+#include "../../../audio/AudioMixer.hpp"
 
-indie::ecs::system::Sound::Sound()
+indie::ecs::system::Sound::Sound() : _mixer(nullptr)
 {
 }
 
@@ -24,19 +25,36 @@ indie::ecs::system::SystemType indie::ecs::system::Sound::getSystemType() const
     return (indie::ecs::system::SystemType::SOUNDSYSTEM);
 }
 
+indie::ecs::system::Access indie::ecs::system::Sound::getAccess() const
+{
+    indie::ecs::system::Access access = {};
+
+    // The command ring of the mixer takes a single producer, the main thread
+    access.reads = componentBit(component::SOUND);
+    access.writes = componentBit(component::SOUND);
+    access.structural = false;
+    access.mainThread = true;
+    return (access);
+}
+
 void indie::ecs::system::Sound::update(std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities)
 {
     for (auto &entity : entities) {
         if (entity->hasCompoType(indie::ecs::component::compoType::SOUND)) {
             auto soundComponent = entity->getComponent<indie::ecs::component::Sound>(indie::ecs::component::SOUND);
-            if (soundComponent->getPlay() == true) {
-                float volume = soundComponent->getVolume();
-
-                indie::raylib::Sound sound(soundComponent->getSoundPath());
-                // sound.setVolume(sound.getVolume());
-                sound.setVolume(volume);
-                sound.play();
+            if (soundComponent->getPlay() == true && this->_mixer != nullptr) {
+                if (soundComponent->getBankId() == indie::audio::SoundBank::NOT_LOADED)
+                    soundComponent->setBankId(this->_mixer->getBank().find(soundComponent->getSoundPath()));
+                this->_mixer->post(soundComponent->getBankId(), soundComponent->getCategory(),
+                    soundComponent->getVolume(), soundComponent->getPriority());
+                // A sound plays once per request
+                soundComponent->setPlay(false);
             }
         }
     }
 }
+
+void indie::ecs::system::Sound::setMixer(indie::audio::AudioMixer *mixer)
+{
+    this->_mixer = mixer;
+}
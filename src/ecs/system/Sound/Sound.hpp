@@ -13,6 +13,14 @@
 
 #include "../ISystem.hpp"
 
+namespace indie
+{
+    namespace audio
+    {
+        class AudioMixer;
+    } // namespace audio
+} // namespace indie
+
 namespace indie
 {
     namespace ecs
@@ -38,9 +46,26 @@ namespace indie
                  * @return indie::ecs::system::SystemType SystemType
                  */
                 indie::ecs::system::SystemType getSystemType() const;
+                /**
+                 * @brief Get what the system touches
+                 * 
+                 * @return indie::ecs::system::Access Components read and written
+                 */
+                indie::ecs::system::Access getAccess() const;
+                /**
+                 * @brief Set the mixer playing the sounds, sounds are not played without one
+                 * 
+                 * @param mixer The audio mixer, its bank holds the preloaded sounds
+                 */
+                void setMixer(indie::audio::AudioMixer *mixer);
 
               protected:
               private:
+                /**
+                 * @brief Mixer playing the sounds
+                 * 
+                 */
+                indie::audio::AudioMixer *_mixer;
             };
         } // namespace system
     }     // namespace ecs
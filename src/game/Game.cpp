@@ -8,6 +8,7 @@
 #include "Game.hpp"
 #include <algorithm>
 #include <chrono>
+#include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <memory>
@@ -20,57 +21,71 @@
 #include "../gameEvents/GameEvents.hpp"
 #include "../map/MapGenerator.hpp"
 #include "../player/Player.hpp"
+#include "../profiling/Counters.hpp"
+#include "../profiling/Resources.hpp"
+#include "../profiling/Trace.hpp"
 #include "../raylib/Raylib.hpp"
 #include "../screens/IScreen.hpp"
+#include "../tools/FrameArena.hpp"
 #include "Colors.hpp"
 
-indie::Game::Game(size_t baseFps)
+indie::Game::Game(size_t baseFps, size_t seats) : _assets(_jobs)
 {
     _fps = baseFps;
-    _players.push_back(player::Player(BLUEPLAYERCOLOR, 0));
-    _players.push_back(player::Player(REDPLAYERCOLOR, 1));
-    _players.push_back(player::Player(GREENPLAYERCOLOR, 2));
-    _players.push_back(player::Player(YELLOWPLAYERCOLOR, 3));
+    _seats = std::clamp<size_t>(seats, MIN_PLAYERS, MAX_PLAYERS);
+    _resourcesMarked = false;
+    indie::profiling::Counters::setJobSystem(&_jobs);
+    createPlayers(_seats);
     _actualScreen = Screens::Menu;
     initSounds();
+    // The files decode while the window opens
+    preloadAssets();
     _menu = new indie::menu::MenuScreen;
     _game = new indie::menu::GameScreen(&_players, &_sound_entities, &_sound_systems);
+    _game->setInputLatency(&_inputLatency);
+    _game->setFrameStats(&_frameStats);
+    _game->setJobSystem(&_jobs);
+    _game->setMixer(&_mixer);
     _premenu = new indie::menu::PreMenuScreen(&_players);
     _gameoptions = new indie::menu::GameOptionsScreen;
     _setFps = new indie::menu::SetFpsScreen;
-    _setSound = new indie::menu::SetSoundScreen(&_sound_entities);
-    _setMusic = new indie::menu::SetMusicScreen(&_musics);
+    _setSound = new indie::menu::SetSoundScreen(&_mixer);
+    _setMusic = new indie::menu::SetMusicScreen(&_music);
 }
 
 indie::Game::~Game()
 {
-    delete _menu;
-    delete _game;
-    delete _premenu;
-    delete _gameoptions;
-    delete _setFps;
-    delete _setSound;
-    delete _setMusic;
+    indie::profiling::Counters::setJobSystem(nullptr);
+    destroyScreens();
 }
 
 void indie::Game::init()
 {
+    drawLoading();
     initScenes();
+    loadSounds();
+    // Whatever is loaded from now on reads its file on the spot
+    _assets.release();
     initMusic();
-    _musics[MENU_SOUND].play();
+    _music.play(_musicTracks[MENU_MUSIC]);
 }
 
 void indie::Game::initMusic()
 {
-    indie::raylib::Sound menuSound("assets/music/music.ogg");
-    menuSound.setVolume(0.5f);
-    _musics.insert({MENU_SOUND, menuSound});
+    _musicTracks[MENU_MUSIC] = _music.addTrack(MENU_MUSIC_PATH);
+    // Without a dedicated track the game keeps the menu music playing
+    _musicTracks[GAME_MUSIC] = std::filesystem::exists(GAME_MUSIC_PATH) ? _music.addTrack(GAME_MUSIC_PATH)
+                                                                       : _musicTracks[MENU_MUSIC];
+    _music.setVolume(0.5f);
+    _music.start();
 }
 
 void indie::Game::initSounds()
 {
     std::unique_ptr<ecs::entity::Entity> bombSound = std::make_unique<ecs::entity::Entity>(indie::ecs::entity::UNKNOWN);
     bombSound->addComponent<ecs::component::Sound>("assets/sound/bomb.ogg", false);
+    bombSound->getComponent<ecs::component::Sound>(ecs::component::compoType::SOUND)
+        ->setCategory(indie::audio::SoundCategory::GAMEPLAY);
     addSoundEntity(std::move(bombSound));
 
     std::unique_ptr<ecs::entity::Entity> gameReadySound =
@@ -83,10 +98,55 @@ void indie::Game::initSounds()
     selectSound->addComponent<ecs::component::Sound>("assets/sound/select.ogg", false);
     addSoundEntity(std::move(selectSound));
 
-    std::unique_ptr<indie::ecs::system::ISystem> soundSystem = std::make_unique<indie::ecs::system::Sound>();
+    std::unique_ptr<indie::ecs::system::Sound> soundSystem = std::make_unique<indie::ecs::system::Sound>();
+    soundSystem->setMixer(&this->_mixer);
     addSoundSystem(std::move(soundSystem));
 }
 
+void indie::Game::loadSounds()
+{
+    for (size_t i = 0; i < this->_sound_entities.size(); i++) {
+        auto sound = this->_sound_entities.at(i)->getComponent<ecs::component::Sound>(ecs::component::compoType::SOUND);
+        const ::Wave *wave = this->_assets.getWave(sound->getSoundPath());
+        // Explosions overlap a lot, the menu sounds do not
+        std::size_t voices = i == BOMB_S ? 8 : 2;
+
+        if (wave != nullptr)
+            sound->setBankId(this->_mixer.getBank().load(sound->getSoundPath(), *wave, voices));
+        else
+            sound->setBankId(this->_mixer.getBank().load(sound->getSoundPath(), voices));
+    }
+    this->_mixer.start();
+}
+
+void indie::Game::preloadAssets()
+{
+    TRACE_ZONE("Game::preloadAssets");
+    _assets.preloadImages("assets/menu");
+    _assets.preloadImages("assets");
+    for (auto &entity : this->_sound_entities)
+        _assets.preloadWave(
+            entity->getComponent<ecs::component::Sound>(ecs::component::compoType::SOUND)->getSoundPath());
+}
+
+void indie::Game::drawLoading()
+{
+    int width = indie::raylib::Window::getWidth();
+    int height = indie::raylib::Window::getHeight();
+
+    while (!_assets.isDecoded() && !indie::raylib::Window::windowShouldClose()) {
+        TRACE_ZONE("Game::drawLoading");
+        int barWidth = static_cast<int>(static_cast<float>(width / 2) * _assets.getProgress());
+
+        indie::raylib::Window::beginDrawing();
+        indie::raylib::Window::clearBackground(RAYWHITE);
+        indie::raylib::Draw(width / 4, height / 2 - 60, 40, BLACK).drawText("Loading");
+        indie::raylib::Rectangle::draw(width / 4, height / 2, width / 2, 20, LIGHTGRAY);
+        indie::raylib::Rectangle::draw(width / 4, height / 2, barWidth, 20, DARKGRAY);
+        indie::raylib::Window::endDrawing();
+    }
+}
+
 void indie::Game::addSoundEntity(std::unique_ptr<indie::ecs::entity::Entity> entity)
 {
     this->_sound_entities.push_back(std::move(entity));
@@ -110,9 +170,40 @@ void indie::Game::initScenes()
 
 bool indie::Game::processEvents()
 {
-    GameEvents gameEvent;
+    TRACE_ZONE("Game::processEvents");
+    bool ret = _gameEvents.inputUpdate(_event);
 
-    bool ret = gameEvent.inputUpdate(_event);
+    if (indie::raylib::Event::isKeyPressed(KEY_F3))
+        _inputLatency.toggle();
+    if (indie::raylib::Event::isKeyPressed(KEY_F5))
+        _frameStats.toggle();
+    if (indie::raylib::Event::isKeyPressed(KEY_F6)) {
+        if (_frameStats.isLogging()) {
+            _frameStats.toggleLog();
+            std::cout << "Frames logged to " << FRAME_STATS_CSV_PATH << std::endl;
+        } else if (!_frameStats.toggleLog()) {
+            std::cerr << "Error: cannot write " << FRAME_STATS_CSV_PATH << std::endl;
+        }
+    }
+    if (indie::raylib::Event::isKeyPressed(KEY_F4)) {
+        if (indie::profiling::Trace::dump())
+            std::cout << "Trace written to " << TRACE_PATH << std::endl;
+        else
+            std::cerr << "Error: cannot write trace " << TRACE_PATH << std::endl;
+    }
+    if (_actualScreen == Screens::Game) {
+        if (_replay.isPlaying()) {
+            if (_event.key.right)
+                seekReplay(_game->getTick() + REPLAY_SEEK_STEP);
+            else if (_event.key.left)
+                seekReplay(_game->getTick() > REPLAY_SEEK_STEP ? _game->getTick() - REPLAY_SEEK_STEP : 0);
+            _replay.apply(_game->getTick(), _event);
+        } else if (_replay.isRecording()) {
+            if (_replay.wantsKeyframe(_game->getTick()))
+                _replay.writeKeyframe(_game->getTick(), _game->captureKeyframe());
+            _replay.record(_game->getTick(), _event);
+        }
+    }
     int swap = handleEvent();
     if (swap == 10)
         return false;
@@ -123,12 +214,19 @@ bool indie::Game::processEvents()
 void indie::Game::update()
 {
     if (_premenu->getIsGameReady()) {
-        this->_game->getPlayersPlaying(this->_players.at(0).getIsPlaying(), this->_players.at(1).getIsPlaying(),
-            this->_players.at(2).getIsPlaying(), this->_players.at(3).getIsPlaying());
-        indie::map::MapGenerator map;
-        map.createWall();
-        this->_game->initMap(map.getMap());
-        this->_game->initEntity();
+        unsigned int seed = static_cast<unsigned int>(time(NULL));
+        std::vector<std::uint8_t> seats(this->_players.size(), indie::replay::Replay::SEAT_PLAYING);
+
+        // The seats no human joined are filled with bots, flagged as such in the replay
+        for (size_t i = 0; i < this->_players.size(); i++) {
+            this->_players.at(i).setIsBot(!this->_players.at(i).getIsPlaying());
+            this->_players.at(i).setIsPlaying(true);
+            if (this->_players.at(i).getIsBot())
+                seats[i] |= indie::replay::Replay::SEAT_BOT;
+        }
+        startMatch(seed);
+        this->_game->enableAutosave();
+        this->_replay.startRecording(REPLAY_PATH, seed, seats);
         _premenu->setIsGameReady(false);
     }
     switch (_actualScreen) {
@@ -143,8 +241,55 @@ void indie::Game::update()
     }
 }
 
+void indie::Game::startMatch(unsigned int seed)
+{
+    indie::map::MapGenerator map;
+    map.createWall(seed, static_cast<int>(this->_players.size()));
+    this->_game->initMap(map.getMap(), map.getSpawns());
+    this->_game->initEntity();
+}
+
+bool indie::Game::playReplay(const std::string &path)
+{
+    if (!this->_replay.load(path))
+        return (false);
+    const std::vector<std::uint8_t> &seats = this->_replay.getSeats();
+    if (seats.size() < MIN_PLAYERS || seats.size() > MAX_PLAYERS) {
+        this->_replay.stop();
+        return (false);
+    }
+    if (seats.size() != this->_players.size())
+        createPlayers(seats.size());
+    for (size_t i = 0; i < this->_players.size(); i++) {
+        this->_players.at(i).setIsPlaying(seats[i] & indie::replay::Replay::SEAT_PLAYING);
+        this->_players.at(i).setIsBot(seats[i] & indie::replay::Replay::SEAT_BOT);
+    }
+    startMatch(this->_replay.getSeed());
+    setActualScreen(Screens::Game);
+    return (true);
+}
+
+bool indie::Game::seekReplay(std::uint32_t tick)
+{
+    std::vector<std::uint8_t> world;
+    std::uint32_t keyframeTick = 0;
+    indie::Event event = _event;
+
+    if (!_replay.seek(tick, world, keyframeTick) || !_game->restoreKeyframe(world, keyframeTick))
+        return (false);
+    _game->setMuted(true);
+    while (_game->getTick() < tick && _replay.isPlaying()) {
+        _replay.apply(_game->getTick(), event);
+        _game->handleEvent(event);
+        _game->update();
+    }
+    _game->setMuted(false);
+    return (true);
+}
+
 void indie::Game::draw()
 {
+    TRACE_ZONE("Game::draw");
     switch (_actualScreen) {
         case Screens::Menu: _menu->draw(); break;
         case Screens::Game: _game->draw(); break;
@@ -174,24 +319,58 @@ int indie::Game::handleEvent()
 
 void indie::Game::run()
 {
+    indie::profiling::Trace::setThreadName("main");
     while (!indie::raylib::Window::windowShouldClose()) {
-        if (!_musics[MENU_SOUND].isPlaying()) {
-            _musics[MENU_SOUND].play();
-        }
+        TRACE_ZONE("Game::frame");
         if (!processEvents())
             break;
-        update();
+        _jobs.runMainThreadJobs();
+        {
+            TRACE_ZONE("Game::update");
+            update();
+        }
         draw();
+        // The end of the draw polled the OS events the next sample reads
+        _gameEvents.markPoll();
+        _frameStats.endFrame();
+        // Menus never tick, the scratch of their draw is released here
+        indie::tools::FrameArena::local().reset();
+        // The buffers have been swapped by the end of draw, the drained input is on screen from now on
+        if (_gameEvents.getDrainedTime())
+            _inputLatency.add(std::chrono::steady_clock::now() - *_gameEvents.getDrainedTime());
     }
 }
 
 void indie::Game::destroy()
 {
+    _replay.stop();
     destroyEntities();
     destroySystems();
+    // The entities of the screens unload their textures, the GL context must still be there
+    destroyScreens();
+    _music.stop();
+    _mixer.stop();
     indie::raylib::Window::destroyWindow();
 }
 
+void indie::Game::destroyScreens()
+{
+    delete _menu;
+    delete _game;
+    delete _premenu;
+    delete _gameoptions;
+    delete _setFps;
+    delete _setSound;
+    delete _setMusic;
+    _menu = nullptr;
+    _game = nullptr;
+    _premenu = nullptr;
+    _gameoptions = nullptr;
+    _setFps = nullptr;
+    _setSound = nullptr;
+    _setMusic = nullptr;
+}
+
 void indie::Game::destroyEntities()
 {
     std::vector<std::unique_ptr<indie::ecs::entity::Entity>>::iterator _it_sound_entities = _sound_entities.begin();
@@ -264,21 +443,37 @@ void indie::Game::handleScreensSwap(int ret)
 
 void indie::Game::reinitGame()
 {
-    _players.clear();
-    _players.push_back(player::Player(BLUEPLAYERCOLOR, 0));
-    _players.push_back(player::Player(REDPLAYERCOLOR, 1));
-    _players.push_back(player::Player(GREENPLAYERCOLOR, 2));
-    _players.push_back(player::Player(YELLOWPLAYERCOLOR, 3));
+    _replay.stop();
+    createPlayers(_seats);
     delete _game;
+    delete _premenu;
+    // Nothing of the match is loaded anymore, whatever it left behind is reported
+    if (_resourcesMarked)
+        indie::profiling::Resources::report(std::cout);
+    indie::profiling::Resources::mark();
+    _resourcesMarked = true;
     _game = new indie::menu::GameScreen(&_players, &_sound_entities, &_sound_systems);
+    _game->setInputLatency(&_inputLatency);
+    _game->setFrameStats(&_frameStats);
+    _game->setJobSystem(&_jobs);
+    _game->setMixer(&_mixer);
     _game->init();
-    delete _premenu;
     _premenu = new indie::menu::PreMenuScreen(&_players);
     _premenu->init();
 }
 
+void indie::Game::createPlayers(size_t seats)
+{
+    _players.clear();
+    _players.reserve(seats);
+    for (size_t i = 0; i < seats; i++)
+        _players.push_back(player::Player(player::Player::getSeatColor(i), static_cast<unsigned short>(i)));
+}
+
 void indie::Game::setActualScreen(Screens newScreen)
 {
+    if ((newScreen == Screens::Game) != (_actualScreen == Screens::Game))
+        _music.play(_musicTracks[newScreen == Screens::Game ? GAME_MUSIC : MENU_MUSIC]);
     _actualScreen = newScreen;
 }
 
@@ -290,10 +485,13 @@ void indie::Game::saveGame()
 
 void indie::Game::loadGame()
 {
-    if (!_game->loadSavedMap()) {
+    bool recovered = _game->hasNewerAutosave() && _game->recoverAutosave();
+
+    if (!recovered && !_game->loadSavedMap()) {
         std::cout << "No game to load" << std::endl;
         return;
     }
     _game->initEntity();
+    _game->enableAutosave();
     setActualScreen(Screens::Game);
 }
@@ -11,14 +11,23 @@
 #include <cstddef>
 #include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
+#include "../audio/MusicPlayer.hpp"
+#include "../audio/AudioMixer.hpp"
+#include "../core/AssetLoader.hpp"
+#include "../core/JobSystem.hpp"
 #include "../ecs/system/Collide/Collide.hpp"
 #include "../ecs/system/Draw2D/Draw2D.hpp"
 #include "../ecs/system/Draw3D/Draw3D.hpp"
 #include "../ecs/system/Movement/Movement.hpp"
 #include "../ecs/system/Sound/Sound.hpp"
+#include "../gameEvents/GameEvents.hpp"
+#include "../gameEvents/InputLatency.hpp"
 #include "../player/Player.hpp"
+#include "../profiling/FrameStats.hpp"
+#include "../replay/Replay.hpp"
 #include "../screens/IScreen.hpp"
 #include "../screens/game/GameScreen.hpp"
 #include "../screens/menu/MenuScreen.hpp"
@@ -29,6 +38,13 @@
 #include "../screens/set_music/SetMusicScreen.hpp"
 #include "../screens/set_sound/SetSoundScreen.hpp"
 
+/// @brief Music of the menus
+#define MENU_MUSIC_PATH "assets/music/music.ogg"
+/// @brief Music of the matches, the menu music is kept when the file is missing
+#define GAME_MUSIC_PATH "assets/music/game.ogg"
+/// @brief Ticks skipped by the left / right keys while watching a replay
+#define REPLAY_SEEK_STEP 600
+
 namespace indie
 {
     /// @brief Game class
@@ -39,10 +55,11 @@ namespace indie
         /// @brief enum containing all type of sounds
         enum Sounds { BOMB_S = 0, GAME_READY_S = 1, SELECT_S = 2 };
         /// @brief enum containing all musics
-        enum Musics { MENU_SOUND };
+        enum Musics { MENU_MUSIC, GAME_MUSIC };
         /// @brief Constructor
         /// @param baseFps base fps (60 by default)
-        Game(size_t baseFps = 60);
+        /// @param seats number of players, humans or bots, clamped between MIN_PLAYERS and MAX_PLAYERS
+        Game(size_t baseFps = 60, size_t seats = DEFAULT_PLAYERS);
         /// @brief Destructor
         ~Game();
         /// @brief Initialize the game class elements
@@ -67,6 +84,21 @@ namespace indie
          *
          */
         void initSounds();
+        /**
+         * @brief Decode the sound effects into the mixer bank and start the mixer, the audio device must be initialized
+         *
+         */
+        void loadSounds();
+        /**
+         * @brief Queue the decoding of the files the screens and the sounds load at startup
+         *
+         */
+        void preloadAssets();
+        /**
+         * @brief Draw the loading screen until every preloaded file is decoded, the window must be open
+         *
+         */
+        void drawLoading();
         /**
          * @brief Init all musics
          *
@@ -87,11 +119,32 @@ namespace indie
          *
          */
         void destroySystems();
+        /**
+         * @brief Destroy the screens and their entities, before the window closes
+         *
+         */
+        void destroyScreens();
         /// @brief Swap between screens
         /// @param ret Scene number
         void handleScreensSwap(int ret);
         /// @brief Reinitialize the game class elements
         void reinitGame();
+        /// @brief Replace the players with fresh ones, their ids are their index
+        /// @param seats Number of players
+        void createPlayers(size_t seats);
+        /// @brief Generate the map and the entities of a new match
+        /// @param seed Seed of the map
+        void startMatch(unsigned int seed);
+        /// @brief Play back a recorded match, must be called after init
+        /// @param path Path of the replay file
+        /// @return true If the replay is loaded
+        bool playReplay(const std::string &path);
+        /// @brief Jump to a tick of the replay being played back
+        ///
+        /// Restores the closest keyframe and simulates the remaining ticks without rendering.
+        /// @param tick Wanted tick
+        /// @return true If the replay has keyframes
+        bool seekReplay(std::uint32_t tick);
         /// @brief Set the actual screen
         /// @param newScreen The new screen
         void setActualScreen(Screens newScreen);
@@ -124,7 +177,11 @@ namespace indie
         Screens _actualScreen;
         /// @brief Game fps
         size_t _fps;
-        /// @brief Players
+        /// @brief Number of players of a new match
+        size_t _seats;
+        /// @brief Whether a match ended already, the resources live between matches are compared from the second one
+        bool _resourcesMarked;
+        /// @brief Players, by id
         std::vector<player::Player> _players;
         /// @brief Menu screen
         indie::menu::MenuScreen *_menu;
@@ -141,10 +198,27 @@ namespace indie
         /// @brief SetMusic screen
         indie::menu::SetMusicScreen *_setMusic;
         /// @brief Actual Event
-        indie::Event _event;
+        indie::Event _event{};
+        /// @brief Input sampler, keeps the presses not consumed yet between frames
+        indie::GameEvents _gameEvents;
+        /// @brief Input to photon latency statistics, toggled with F3
+        indie::InputLatency _inputLatency;
+        /// @brief Frame time and per system cost overlay, toggled with F5, logged to CSV with F6
+        indie::profiling::FrameStats _frameStats;
+        /// @brief Worker threads shared by the engine, its main thread queue is run once per frame
+        indie::core::JobSystem _jobs;
+        /// @brief Startup assets decoded on the workers, released once every screen is built
+        indie::core::AssetLoader _assets;
+        /// @brief Audio thread playing the sound effects, decoded once in init
+        indie::audio::AudioMixer _mixer;
         std::vector<std::unique_ptr<indie::ecs::entity::Entity>> _sound_entities;
         std::vector<std::unique_ptr<indie::ecs::system::ISystem>> _sound_systems;
-        std::map<int, indie::raylib::Sound> _musics;
+        /// @brief Streamed background music
+        indie::audio::MusicPlayer _music;
+        /// @brief Track of each music in the player
+        std::map<int, int> _musicTracks;
+        /// @brief Recording of the current match, or the replay being played back
+        indie::replay::Replay _replay;
     };
 } // namespace indie
 
@@ -13,186 +13,191 @@
 #include <iostream>
 #include "../raylib/Raylib.hpp"
 
+namespace
+{
+    /// @brief Key flags of indie::Event::KeyEvent, indexed by the value of SYSTEM_KEY changes
+    constexpr bool indie::Event::KeyEvent::*SYSTEM_FIELDS[] = {&indie::Event::KeyEvent::down,
+        &indie::Event::KeyEvent::right, &indie::Event::KeyEvent::left, &indie::Event::KeyEvent::up,
+        &indie::Event::KeyEvent::enter, &indie::Event::KeyEvent::l_control, &indie::Event::KeyEvent::r_control,
+        &indie::Event::KeyEvent::l_alt, &indie::Event::KeyEvent::r_alt, &indie::Event::KeyEvent::l_shift,
+        &indie::Event::KeyEvent::r_shift};
+    /// @brief Raylib keys matching SYSTEM_FIELDS
+    constexpr KeyboardKey SYSTEM_KEYS[] = {KEY_DOWN, KEY_RIGHT, KEY_LEFT, KEY_UP, KEY_ENTER, KEY_LEFT_CONTROL,
+        KEY_RIGHT_CONTROL, KEY_LEFT_ALT, KEY_RIGHT_ALT, KEY_LEFT_SHIFT, KEY_RIGHT_SHIFT};
+    constexpr std::size_t SYSTEM_COUNT = sizeof(SYSTEM_KEYS) / sizeof(SYSTEM_KEYS[0]);
+    static_assert(SYSTEM_COUNT == sizeof(SYSTEM_FIELDS) / sizeof(SYSTEM_FIELDS[0]));
+    /// @brief Controller buttons, by priority
+    constexpr indie::Event::ControllerCode BUTTONS[] = {indie::Event::X_BUTTON, indie::Event::O_BUTTON,
+        indie::Event::T_BUTTON, indie::Event::OPTION_BUTTON, indie::Event::UP_BUTTON, indie::Event::DOWN_BUTTON,
+        indie::Event::LEFT_BUTTON, indie::Event::RIGHT_BUTTON};
+
+    /**
+     * @brief Map a raylib key to the character stored in indie::Event::KeyEvent::code
+     *
+     * @param key Raylib key code
+     * @return char The character, '\0' for keys the game does not use
+     */
+    char keyToChar(int key)
+    {
+        if (key >= KEY_A && key <= KEY_Z)
+            return (static_cast<char>('a' + (key - KEY_A)));
+        switch (key) {
+            case KEY_SPACE: return (' ');
+            case KEY_APOSTROPHE: return ('\'');
+            case KEY_TAB: return ('\t');
+            default: return ('\0');
+        }
+    }
+
+    /**
+     * @brief Convert joystick axes to a direction
+     *
+     * @param x X axis
+     * @param y Y axis
+     * @return indie::Event::JoystickDirection The direction
+     */
+    indie::Event::JoystickDirection axesToDirection(float x, float y)
+    {
+        if (x >= -1 && x <= -0.75)
+            return (indie::Event::JoystickDirection::LEFT);
+        if (x >= 0.75 && x <= 1)
+            return (indie::Event::JoystickDirection::RIGHT);
+        if (y >= -1 && y <= -0.75)
+            return (indie::Event::JoystickDirection::UP);
+        if (y >= 0.75 && y <= 1)
+            return (indie::Event::JoystickDirection::DOWN);
+        return (indie::Event::JoystickDirection::JOYSTICK_NONE);
+    }
+} // namespace
+
 namespace indie
 {
-    void GameEvents::getCharKeys(indie::Event &event)
+    GameEvents::GameEvents() : _leftJoystick(), _rightJoystick(), _connected()
     {
-        if (indie::raylib::Event::isKeyPressed(KEY_A))
-            event.key.code = 'a';
-        else if (indie::raylib::Event::isKeyPressed(KEY_B))
-            event.key.code = 'b';
-        else if (indie::raylib::Event::isKeyPressed(KEY_C))
-            event.key.code = 'c';
-        else if (indie::raylib::Event::isKeyPressed(KEY_D))
-            event.key.code = 'd';
-        else if (indie::raylib::Event::isKeyPressed(KEY_E))
-            event.key.code = 'e';
-        else if (indie::raylib::Event::isKeyPressed(KEY_F))
-            event.key.code = 'f';
-        else if (indie::raylib::Event::isKeyPressed(KEY_G))
-            event.key.code = 'g';
-        else if (indie::raylib::Event::isKeyPressed(KEY_H))
-            event.key.code = 'h';
-        else if (indie::raylib::Event::isKeyPressed(KEY_I))
-            event.key.code = 'i';
-        else if (indie::raylib::Event::isKeyPressed(KEY_J))
-            event.key.code = 'j';
-        else if (indie::raylib::Event::isKeyPressed(KEY_K))
-            event.key.code = 'k';
-        else if (indie::raylib::Event::isKeyPressed(KEY_L))
-            event.key.code = 'l';
-        else if (indie::raylib::Event::isKeyPressed(KEY_M))
-            event.key.code = 'm';
-        else if (indie::raylib::Event::isKeyPressed(KEY_N))
-            event.key.code = 'n';
-        else if (indie::raylib::Event::isKeyPressed(KEY_O))
-            event.key.code = 'o';
-        else if (indie::raylib::Event::isKeyPressed(KEY_P))
-            event.key.code = 'p';
-        else if (indie::raylib::Event::isKeyPressed(KEY_Q))
-            event.key.code = 'q';
-        else if (indie::raylib::Event::isKeyPressed(KEY_R))
-            event.key.code = 'r';
-        else if (indie::raylib::Event::isKeyPressed(KEY_S))
-            event.key.code = 's';
-        else if (indie::raylib::Event::isKeyPressed(KEY_T))
-            event.key.code = 't';
-        else if (indie::raylib::Event::isKeyPressed(KEY_U))
-            event.key.code = 'u';
-        else if (indie::raylib::Event::isKeyPressed(KEY_V))
-            event.key.code = 'v';
-        else if (indie::raylib::Event::isKeyPressed(KEY_W))
-            event.key.code = 'w';
-        else if (indie::raylib::Event::isKeyPressed(KEY_X))
-            event.key.code = 'x';
-        else if (indie::raylib::Event::isKeyPressed(KEY_Y))
-            event.key.code = 'y';
-        else if (indie::raylib::Event::isKeyPressed(KEY_Z))
-            event.key.code = 'z';
-        else if (indie::raylib::Event::isKeyPressed(KEY_SPACE))
-            event.key.code = ' ';
-        else if (indie::raylib::Event::isKeyPressed(KEY_APOSTROPHE))
-            event.key.code = '\'';
-        else if (indie::raylib::Event::isKeyPressed(KEY_TAB))
-            event.key.code = '\t';
-        else
-            event.key.code = '\0';
     }
 
-    void GameEvents::getSystemKeys(indie::Event &event)
+    void GameEvents::push(
+        InputEvent::Type type, int controller, int value, std::chrono::steady_clock::time_point time)
+    {
+        _queue.push_back({time, type, static_cast<std::uint8_t>(controller), static_cast<std::int16_t>(value)});
+    }
+
+    void GameEvents::getCharKeys(std::chrono::steady_clock::time_point time)
+    {
+        for (int key = indie::raylib::Event::getKeyPressed(); key != 0; key = indie::raylib::Event::getKeyPressed()) {
+            char code = keyToChar(key);
+            if (code != '\0')
+                push(InputEvent::CHAR_KEY, 0, code, time);
+        }
+    }
+
+    void GameEvents::getSystemKeys(std::chrono::steady_clock::time_point time)
+    {
+        for (std::size_t i = 0; i < SYSTEM_COUNT; i++)
+            if (indie::raylib::Event::isKeyPressed(SYSTEM_KEYS[i]))
+                push(InputEvent::SYSTEM_KEY, 0, static_cast<int>(i), time);
+    }
+
+    void GameEvents::getControllerEvents(int controllerId, std::chrono::steady_clock::time_point time)
+    {
+        bool connected = indie::raylib::Event::isGamepadAvailable(controllerId);
+
+        if (connected != _connected[controllerId]) {
+            _connected[controllerId] = connected;
+            push(InputEvent::CONNECTED, controllerId, connected, time);
+        }
+        if (!connected)
+            return;
+        for (auto button : BUTTONS)
+            if (indie::raylib::Event::isGamepadButtonPressed(controllerId, button))
+                push(InputEvent::BUTTON, controllerId, button, time);
+        indie::Event::JoystickDirection left =
+            axesToDirection(indie::raylib::Event::getGamepadAxisMovement(controllerId, 0),
+                indie::raylib::Event::getGamepadAxisMovement(controllerId, 1));
+        indie::Event::JoystickDirection right =
+            axesToDirection(indie::raylib::Event::getGamepadAxisMovement(controllerId, 2),
+                indie::raylib::Event::getGamepadAxisMovement(controllerId, 3));
+        if (left != _leftJoystick[controllerId]) {
+            _leftJoystick[controllerId] = left;
+            push(InputEvent::LEFT_JOYSTICK, controllerId, left, time);
+        }
+        if (right != _rightJoystick[controllerId]) {
+            _rightJoystick[controllerId] = right;
+            push(InputEvent::RIGHT_JOYSTICK, controllerId, right, time);
+        }
+    }
+
+    void GameEvents::sample()
+    {
+        // Before the first two polls the sample itself is the best known bound
+        auto time = _previousPoll.value_or(_lastPoll.value_or(std::chrono::steady_clock::now()));
+
+        this->getCharKeys(time);
+        this->getSystemKeys(time);
+        for (int i = 0; i < EVENT_CONTROLLERS; i++)
+            this->getControllerEvents(i, time);
+    }
+
+    void GameEvents::drain(indie::Event &event)
+    {
+        bool charUsed = false;
+
+        event.key.code = '\0';
+        for (auto field : SYSTEM_FIELDS)
+            event.key.*field = false;
+        for (auto &controller : event.controller)
+            controller.code = indie::Event::ControllerCode::CONTROLLER_NONE;
+        _drainedTime.reset();
+        while (!_queue.empty()) {
+            const InputEvent *input = &_queue.front();
+            if (input->type == InputEvent::CHAR_KEY) {
+                if (charUsed)
+                    break;
+                event.key.code = static_cast<char>(input->value);
+                charUsed = true;
+            } else if (input->type == InputEvent::SYSTEM_KEY) {
+                if (event.key.*SYSTEM_FIELDS[input->value])
+                    break;
+                event.key.*SYSTEM_FIELDS[input->value] = true;
+            } else if (input->type == InputEvent::BUTTON) {
+                if (event.controller[input->controller].code != indie::Event::ControllerCode::CONTROLLER_NONE)
+                    break;
+                event.controller[input->controller].code = input->value;
+            } else if (input->type == InputEvent::LEFT_JOYSTICK) {
+                event.controller[input->controller].leftJoystick =
+                    static_cast<indie::Event::JoystickDirection>(input->value);
+            } else if (input->type == InputEvent::RIGHT_JOYSTICK) {
+                event.controller[input->controller].rightJoystick =
+                    static_cast<indie::Event::JoystickDirection>(input->value);
+            } else {
+                event.controller[input->controller].connected = input->value;
+                if (!input->value) {
+                    event.controller[input->controller].leftJoystick = indie::Event::JOYSTICK_NONE;
+                    event.controller[input->controller].rightJoystick = indie::Event::JOYSTICK_NONE;
+                }
+            }
+            if (!_drainedTime)
+                _drainedTime = input->time;
+            _queue.pop_front();
+        }
+    }
+
+    std::optional<std::chrono::steady_clock::time_point> GameEvents::getDrainedTime() const
     {
-        if (indie::raylib::Event::isKeyPressed(KEY_DOWN))
-            event.key.down = true;
-        else
-            event.key.down = false;
-        if (indie::raylib::Event::isKeyPressed(KEY_RIGHT))
-            event.key.right = true;
-        else
-            event.key.right = false;
-        if (indie::raylib::Event::isKeyPressed(KEY_LEFT))
-            event.key.left = true;
-        else
-            event.key.left = false;
-        if (indie::raylib::Event::isKeyPressed(KEY_UP))
-            event.key.up = true;
-        else
-            event.key.up = false;
-        if (indie::raylib::Event::isKeyPressed(KEY_ENTER))
-            event.key.enter = true;
-        else
-            event.key.enter = false;
-        if (indie::raylib::Event::isKeyPressed(KEY_LEFT_CONTROL))
-            event.key.l_control = true;
-        else
-            event.key.l_control = false;
-        if (indie::raylib::Event::isKeyPressed(KEY_RIGHT_CONTROL))
-            event.key.r_control = true;
-        else
-            event.key.r_control = false;
-        if (indie::raylib::Event::isKeyPressed(KEY_LEFT_ALT))
-            event.key.l_alt = true;
-        else
-            event.key.l_alt = false;
-        if (indie::raylib::Event::isKeyPressed(KEY_RIGHT_ALT))
-            event.key.r_alt = true;
-        else
-            event.key.r_alt = false;
-        if (indie::raylib::Event::isKeyPressed(KEY_LEFT_SHIFT))
-            event.key.l_shift = true;
-        else
-            event.key.l_shift = false;
-        if (indie::raylib::Event::isKeyPressed(KEY_RIGHT_SHIFT))
-            event.key.r_shift = true;
-        else
-            event.key.r_shift = false;
+        return (_drainedTime);
     }
 
-    void GameEvents::getControllerEvents(indie::Event &event, int controllerId)
+    void GameEvents::markPoll()
     {
-        if (indie::raylib::Event::isGamepadAvailable(controllerId)) {
-            if (indie::raylib::Event::isGamepadButtonPressed(controllerId, indie::Event::ControllerCode::X_BUTTON))
-                event.controller[controllerId].code = indie::Event::ControllerCode::X_BUTTON;
-            else if (indie::raylib::Event::isGamepadButtonPressed(controllerId, indie::Event::ControllerCode::O_BUTTON))
-                event.controller[controllerId].code = indie::Event::ControllerCode::O_BUTTON;
-            else if (indie::raylib::Event::isGamepadButtonPressed(controllerId, indie::Event::ControllerCode::T_BUTTON))
-                event.controller[controllerId].code = indie::Event::ControllerCode::T_BUTTON;
-            else if (indie::raylib::Event::isGamepadButtonPressed(
-                         controllerId, indie::Event::ControllerCode::OPTION_BUTTON))
-                event.controller[controllerId].code = indie::Event::ControllerCode::OPTION_BUTTON;
-            else if (indie::raylib::Event::isGamepadButtonPressed(
-                         controllerId, indie::Event::ControllerCode::UP_BUTTON))
-                event.controller[controllerId].code = indie::Event::ControllerCode::UP_BUTTON;
-            else if (indie::raylib::Event::isGamepadButtonPressed(
-                         controllerId, indie::Event::ControllerCode::DOWN_BUTTON))
-                event.controller[controllerId].code = indie::Event::ControllerCode::DOWN_BUTTON;
-            else if (indie::raylib::Event::isGamepadButtonPressed(
-                         controllerId, indie::Event::ControllerCode::LEFT_BUTTON))
-                event.controller[controllerId].code = indie::Event::ControllerCode::LEFT_BUTTON;
-            else if (indie::raylib::Event::isGamepadButtonPressed(
-                         controllerId, indie::Event::ControllerCode::RIGHT_BUTTON))
-                event.controller[controllerId].code = indie::Event::ControllerCode::RIGHT_BUTTON;
-            else
-                event.controller[controllerId].code = indie::Event::ControllerCode::CONTROLLER_NONE;
-
-            float xAxisLeft = indie::raylib::Event::getGamepadAxisMovement(controllerId, 0);
-            float yAxisLeft = indie::raylib::Event::getGamepadAxisMovement(controllerId, 1);
-            float xAxisRight = indie::raylib::Event::getGamepadAxisMovement(controllerId, 2);
-            float yAxisRight = indie::raylib::Event::getGamepadAxisMovement(controllerId, 3);
-
-            if (xAxisLeft >= -1 && xAxisLeft <= -0.75)
-                event.controller[controllerId].leftJoystick = indie::Event::JoystickDirection::LEFT;
-            else if (xAxisLeft >= 0.75 && xAxisLeft <= 1)
-                event.controller[controllerId].leftJoystick = indie::Event::JoystickDirection::RIGHT;
-            else if (yAxisLeft >= -1 && yAxisLeft <= -0.75)
-                event.controller[controllerId].leftJoystick = indie::Event::JoystickDirection::UP;
-            else if (yAxisLeft >= 0.75 && yAxisLeft <= 1)
-                event.controller[controllerId].leftJoystick = indie::Event::JoystickDirection::DOWN;
-            else
-                event.controller[controllerId].leftJoystick = indie::Event::JoystickDirection::JOYSTICK_NONE;
-            if (xAxisRight >= -1 && xAxisRight <= -0.75)
-                event.controller[controllerId].rightJoystick = indie::Event::JoystickDirection::LEFT;
-            else if (xAxisRight >= 0.75 && xAxisRight <= 1)
-                event.controller[controllerId].rightJoystick = indie::Event::JoystickDirection::RIGHT;
-            else if (yAxisRight >= -1 && yAxisRight <= -0.75)
-                event.controller[controllerId].rightJoystick = indie::Event::JoystickDirection::UP;
-            else if (yAxisRight >= 0.75 && yAxisRight <= 1)
-                event.controller[controllerId].rightJoystick = indie::Event::JoystickDirection::DOWN;
-            else
-                event.controller[controllerId].rightJoystick = indie::Event::JoystickDirection::JOYSTICK_NONE;
-            event.controller[controllerId].connected = true;
-        } else
-            event.controller[controllerId].connected = false;
+        _previousPoll = _lastPoll;
+        _lastPoll = std::chrono::steady_clock::now();
     }
 
     bool GameEvents::inputUpdate(indie::Event &event)
     {
         event.resized = indie::raylib::Window::isWindowResized();
-        this->getCharKeys(event);
-        this->getSystemKeys(event);
-        this->getControllerEvents(event, 0);
-        this->getControllerEvents(event, 1);
-        this->getControllerEvents(event, 2);
-        this->getControllerEvents(event, 3);
+        this->sample();
+        this->drain(event);
         if (indie::raylib::Event::isKeyPressed(KEY_ESCAPE))
             return false;
         return true;
@@ -12,16 +12,47 @@
 #ifndef GAMEEVENTS_HPP_
 #define GAMEEVENTS_HPP_
 
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <optional>
+
 #include "events.hpp"
 
 namespace indie
 {
+    /**
+     * @brief A timestamped input change
+     *
+     */
+    struct InputEvent {
+        /// @brief Kind of input change
+        enum Type : std::uint8_t { CHAR_KEY, SYSTEM_KEY, BUTTON, LEFT_JOYSTICK, RIGHT_JOYSTICK, CONNECTED };
+        /// @brief Earliest time the change can have happened, the OS poll before the one that reported it
+        std::chrono::steady_clock::time_point time;
+        /// @brief Kind of change
+        Type type;
+        /// @brief Controller index for controller changes
+        std::uint8_t controller;
+        /// @brief Character, system key index, button code, joystick direction or connection state
+        std::int16_t value;
+    };
+
     /**
      * @brief Events base class
      *
+     * Input is sampled into a queue of timestamped changes and drained into an indie::Event right before the
+     * simulation consumes it. Presses happening in the same frame are all kept and delivered on the following ticks
+     * instead of only keeping the first one.
+     *
      */
     class GameEvents {
       public:
+        /**
+         * @brief Construct a new GameEvents object
+         *
+         */
+        GameEvents();
         /**
          * @brief Get input events and update game
          * 
@@ -33,26 +64,98 @@ namespace indie
         bool inputUpdate(indie::Event &event);
 
         /**
-         * @brief Get a char input
+         * @brief Sample the keyboard and the controllers and queue the changes
+         *
+         * Raylib (GLFW) only allows input polling from the main thread, so this runs on the main thread as late as
+         * possible before the tick.
+         */
+        void sample();
+
+        /**
+         * @brief Apply the queued changes to an event
+         *
+         * At most one press per key kind and per controller is applied, the following ones stay queued for the next
+         * ticks.
          *
          * @param event event class to modify
          */
-        void getCharKeys(indie::Event &event);
+        void drain(indie::Event &event);
+
+        /**
+         * @brief Get a char input
+         *
+         * @param time Time stamped on the changes
+         */
+        void getCharKeys(std::chrono::steady_clock::time_point time);
 
         /**
          * @brief Get a system input
          *
-         * @param event event class to modify
+         * @param time Time stamped on the changes
          */
-        void getSystemKeys(indie::Event &event);
+        void getSystemKeys(std::chrono::steady_clock::time_point time);
 
         /**
          * @brief Get a controller event
          *
-         * @param event event class to modify
          * @param controllerId id of the controller
+         * @param time Time stamped on the changes
+         */
+        void getControllerEvents(int controllerId, std::chrono::steady_clock::time_point time);
+
+        /**
+         * @brief Sampling time of the oldest change applied by the last drain
+         *
+         * @return std::optional<std::chrono::steady_clock::time_point> Nothing if the last drain applied no change
+         */
+        std::optional<std::chrono::steady_clock::time_point> getDrainedTime() const;
+
+        /**
+         * @brief Note that the OS events have just been polled, called right after the buffer swap
+         *
+         * Raylib polls the OS events at the end of each frame and sample reads their state at the start of the next
+         * one: a change it finds happened between the last two polls, so it is stamped with the older one. The
+         * measured latency then includes the wait for the poll, up to a frame, instead of starting at the sample.
+         */
+        void markPoll();
+
+      private:
+        /**
+         * @brief Queue a change
+         *
+         * @param type Kind of change
+         * @param controller Controller index
+         * @param value Value of the change
+         * @param time Time stamped on the changes
+         */
+        void push(InputEvent::Type type, int controller, int value, std::chrono::steady_clock::time_point time);
+        /**
+         * @brief Sampled changes waiting for the simulation, sampled and drained on the main thread
+         *
+         */
+        std::deque<InputEvent> _queue;
+        /**
+         * @brief Last sampled joysticks and connection state, changes are only queued when they differ
+         *
+         */
+        indie::Event::JoystickDirection _leftJoystick[EVENT_CONTROLLERS];
+        indie::Event::JoystickDirection _rightJoystick[EVENT_CONTROLLERS];
+        bool _connected[EVENT_CONTROLLERS];
+        /**
+         * @brief Sampling time of the oldest change applied by the last drain
+         *
+         */
+        std::optional<std::chrono::steady_clock::time_point> _drainedTime;
+        /**
+         * @brief Time of the last OS poll
+         *
+         */
+        std::optional<std::chrono::steady_clock::time_point> _lastPoll;
+        /**
+         * @brief Time of the OS poll before the last one
+         *
          */
-        void getControllerEvents(indie::Event &event, int controllerId);
+        std::optional<std::chrono::steady_clock::time_point> _previousPoll;
     };
 } // namespace indie
 
@@ -0,0 +1,76 @@
+/**
+ * @file InputLatency.cpp
+ * @brief Input to photon latency statistics
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "InputLatency.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+indie::InputLatency::InputLatency() : _samples(), _count(0), _next(0), _visible(false)
+{
+}
+
+void indie::InputLatency::add(std::chrono::steady_clock::duration latency)
+{
+    this->_samples[this->_next] = std::chrono::duration<double, std::milli>(latency).count();
+    this->_next = (this->_next + 1) % WINDOW;
+    if (this->_count < WINDOW)
+        this->_count++;
+}
+
+double indie::InputLatency::getMean() const
+{
+    double sum = 0;
+
+    if (this->_count == 0)
+        return (0);
+    for (std::size_t i = 0; i < this->_count; i++)
+        sum += this->_samples[i];
+    return (sum / this->_count);
+}
+
+double indie::InputLatency::getPercentile95() const
+{
+    std::vector<double> sorted(this->_samples.begin(), this->_samples.begin() + this->_count);
+
+    if (sorted.empty())
+        return (0);
+    std::size_t rank = (sorted.size() * 95) / 100;
+    if (rank >= sorted.size())
+        rank = sorted.size() - 1;
+    std::nth_element(sorted.begin(), sorted.begin() + rank, sorted.end());
+    return (sorted[rank]);
+}
+
+double indie::InputLatency::getMax() const
+{
+    if (this->_count == 0)
+        return (0);
+    return (*std::max_element(this->_samples.begin(), this->_samples.begin() + this->_count));
+}
+
+std::string indie::InputLatency::toString() const
+{
+    char buffer[96];
+
+    std::snprintf(buffer, sizeof(buffer), "input latency  avg %.1f ms  p95 %.1f ms  max %.1f ms", getMean(),
+        getPercentile95(), getMax());
+    return (buffer);
+}
+
+void indie::InputLatency::toggle()
+{
+    this->_visible = !this->_visible;
+}
+
+bool indie::InputLatency::isVisible() const
+{
+    return (this->_visible);
+}
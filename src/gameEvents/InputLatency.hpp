@@ -0,0 +1,103 @@
+/**
+ * @file InputLatency.hpp
+ * @brief Input to photon latency statistics
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef INPUTLATENCY_HPP_
+#define INPUTLATENCY_HPP_
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+namespace indie
+{
+    /**
+     * @brief Rolling statistics of the delay between an input and the end of the frame showing its effect
+     *
+     */
+    class InputLatency {
+      public:
+        /**
+         * @brief Construct a new InputLatency object
+         *
+         */
+        InputLatency();
+        /**
+         * @brief Add a measure
+         *
+         * @param latency Time between the OS poll before the input was reported and the buffer swap
+         */
+        void add(std::chrono::steady_clock::duration latency);
+        /**
+         * @brief Mean of the window, in milliseconds
+         *
+         * @return double Mean latency
+         */
+        double getMean() const;
+        /**
+         * @brief 95th percentile of the window, in milliseconds
+         *
+         * @return double 95th percentile latency
+         */
+        double getPercentile95() const;
+        /**
+         * @brief Maximum of the window, in milliseconds
+         *
+         * @return double Maximum latency
+         */
+        double getMax() const;
+        /**
+         * @brief Format the statistics for the readout
+         *
+         * @return std::string The readout text
+         */
+        std::string toString() const;
+        /**
+         * @brief Show or hide the readout
+         *
+         */
+        void toggle();
+        /**
+         * @brief Is the readout shown?
+         *
+         * @return true If the readout must be drawn
+         */
+        bool isVisible() const;
+
+      private:
+        /**
+         * @brief Number of measures kept
+         *
+         */
+        static constexpr std::size_t WINDOW = 256;
+        /**
+         * @brief Last measures in milliseconds, used as a ring
+         *
+         */
+        std::array<double, WINDOW> _samples;
+        /**
+         * @brief Number of valid measures
+         *
+         */
+        std::size_t _count;
+        /**
+         * @brief Index of the next measure
+         *
+         */
+        std::size_t _next;
+        /**
+         * @brief Is the readout shown?
+         *
+         */
+        bool _visible;
+    };
+} // namespace indie
+
+#endif /* !INPUTLATENCY_HPP_ */
@@ -6,6 +6,7 @@
 */
 
 #include <iostream>
+#include <string>
 #include "Colors.hpp"
 #include "ecs/component/IComponent.hpp"
 #include "ecs/entity/Entity.hpp"
@@ -14,13 +15,21 @@
 #include "player/Player.hpp"
 #include "raylib/Raylib.hpp"
 
-int main(void)
+int main(int ac, char **av)
 {
     try {
-        indie::Game Game(60);
+        // The seats no human joins are played by bots
+        size_t seats = (ac >= 3 && std::string(av[1]) == "--players") ? std::stoul(av[2]) : DEFAULT_PLAYERS;
+        indie::Game Game(60, seats);
         indie::raylib::Window::getInstance(1495, 982, "Indie Studio", true, 60);
 
         Game.init();
+        if (ac >= 3 && std::string(av[1]) == "--replay") {
+            if (!Game.playReplay(av[2]))
+                std::cerr << "Error: cannot play replay " << av[2] << std::endl;
+            else if (ac == 5 && std::string(av[3]) == "--seek" && !Game.seekReplay(std::stoul(av[4])))
+                std::cerr << "Error: replay " << av[2] << " has no keyframe" << std::endl;
+        }
         Game.run();
         Game.destroy();
     } catch (std::exception &e) {
@@ -10,10 +10,12 @@
  */
 
 #include "MapGenerator.hpp"
+#include "../profiling/Trace.hpp"
 
-void indie::map::MapGenerator::createWall()
+void indie::map::MapGenerator::createWall(unsigned int seed, int players)
 {
-    srand(time(NULL));
+    TRACE_ZONE("MapGenerator::createWall");
+    _rng.seed(seed);
     for (int i = 0; i < 21; i++) {
         std::vector<char> tmp;
         for (int j = 0; j < 21; j++)
@@ -23,7 +25,7 @@ void indie::map::MapGenerator::createWall()
     placeBoxes();
     placeRandomEmptySpace();
     placeBonusBoxes();
-    placePlayers();
+    placePlayers(players);
 }
 
 void indie::map::MapGenerator::placeBoxes()
@@ -72,20 +74,40 @@ void indie::map::MapGenerator::placeBonusBoxes()
     }
 }
 
-void indie::map::MapGenerator::placePlayers()
+void indie::map::MapGenerator::placePlayers(int players)
 {
-    _map[1][1] = PLAYER3;
-    _map[1][2] = EMPTY;
-    _map[2][1] = EMPTY;
-    _map[1][19] = PLAYER4;
-    _map[1][18] = EMPTY;
-    _map[2][19] = EMPTY;
-    _map[19][1] = PLAYER1;
-    _map[19][2] = EMPTY;
-    _map[18][1] = EMPTY;
-    _map[19][19] = PLAYER2;
-    _map[18][19] = EMPTY;
-    _map[19][18] = EMPTY;
+    // The first four players keep their corners, the others are spread over the four sides of the inner ring
+    static const std::pair<int, int> corners[] = {{19, 1}, {19, 19}, {1, 1}, {1, 19}};
+    int extra = players > 4 ? players - 4 : 0;
+    int perSide = (extra + 3) / 4;
+
+    _spawns.clear();
+    for (int player = 0; player < players; player++) {
+        std::pair<int, int> spawn;
+        if (player < 4) {
+            spawn = corners[player];
+        } else {
+            int side = (player - 4) % 4;
+            int offset = 1 + ((player - 4) / 4 + 1) * 18 / (perSide + 1);
+            switch (side) {
+                case 0: spawn = {1, offset}; break;
+                case 1: spawn = {19, 20 - offset}; break;
+                case 2: spawn = {20 - offset, 1}; break;
+                default: spawn = {offset, 19}; break;
+            }
+        }
+        _spawns.push_back(spawn);
+        // The spawn and its neighbours on the ring are cleared so every player can move away from its bomb
+        _map[spawn.first][spawn.second] = EMPTY;
+        if (spawn.first == 1 || spawn.first == 19) {
+            _map[spawn.first][spawn.second > 1 ? spawn.second - 1 : 2] = EMPTY;
+            _map[spawn.first][spawn.second < 19 ? spawn.second + 1 : 18] = EMPTY;
+        }
+        if (spawn.second == 1 || spawn.second == 19) {
+            _map[spawn.first > 1 ? spawn.first - 1 : 2][spawn.second] = EMPTY;
+            _map[spawn.first < 19 ? spawn.first + 1 : 18][spawn.second] = EMPTY;
+        }
+    }
 }
 
 int indie::map::MapGenerator::countBonusOnLine(int i)
@@ -102,5 +124,5 @@ int indie::map::MapGenerator::generateRandomNumber(int nbrMax)
 {
     if (nbrMax == 0)
         return 0;
-    return (rand() % nbrMax) + 1;
+    return (static_cast<int>(_rng() % static_cast<unsigned int>(nbrMax)) + 1);
 }
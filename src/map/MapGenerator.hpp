@@ -18,8 +18,10 @@
 #include <cstdlib>
 #include <ctime>
 #include <iostream>
+#include <random>
 #include <stdio.h>
 #include <string.h>
+#include <utility>
 #include <vector>
 
 /**
@@ -52,26 +54,6 @@
  * 
  */
 #define BOMB_RADIUS 'R'
-/**
- * @brief Macro for player1
- * 
- */
-#define PLAYER1     '1'
-/**
- * @brief Macro for player2
- * 
- */
-#define PLAYER2     '2'
-/**
- * @brief Macro for player3
- * 
- */
-#define PLAYER3     '3'
-/**
- * @brief Macro for player4
- * 
- */
-#define PLAYER4     '4'
 
 namespace indie
 {
@@ -107,8 +89,11 @@ namespace indie
 
             /**
              * @brief Create a Wall
+             *
+             * @param seed Seed of the map, the same seed always generates the same map
+             * @param players Number of spawns to clear
              */
-            void createWall();
+            void createWall(unsigned int seed = static_cast<unsigned int>(time(NULL)), int players = 4);
             /**
              * @brief Place a box
              */
@@ -122,9 +107,11 @@ namespace indie
              */
             void placeBonusBoxes();
             /**
-             * @brief Place the players
+             * @brief Clear the spawns of the players, the four corners then evenly along the sides of the inner ring
+             *
+             * @param players Number of spawns
              */
-            void placePlayers();
+            void placePlayers(int players);
             /**
              * @brief Count the bonuses on a line
              *
@@ -149,9 +136,28 @@ namespace indie
             {
                 return _map;
             };
+            /**
+             * @brief Get the spawn of each player
+             *
+             * @return const std::vector<std::pair<int, int>>& Row and column of each spawn, by player index
+             */
+            inline const std::vector<std::pair<int, int>> &getSpawns(void) const
+            {
+                return _spawns;
+            };
 
           private:
             std::vector<std::vector<char>> _map;
+            /**
+             * @brief Row and column of the spawn of each player
+             *
+             */
+            std::vector<std::pair<int, int>> _spawns;
+            /**
+             * @brief Random generator, its sequence is fixed for a given seed on every platform
+             *
+             */
+            std::mt19937 _rng;
         };
     } // namespace map
 } // namespace indie
@@ -10,6 +10,7 @@
  */
 
 #include "Player.hpp"
+#include "Colors.hpp"
 
 namespace indie
 {
@@ -22,12 +23,20 @@ namespace indie
             this->_controllerId = controllerId;
             this->_isAlive = isAlive;
             this->_isPlaying = isPlaying;
+            this->_isBot = false;
             this->_bombRadius = bombRadius;
             this->_bombStock = bombStock;
             this->_maxBombStock = maxBombStock;
             this->_speed = speed;
         }
 
+        Color Player::getSeatColor(std::size_t seat)
+        {
+            static const Color colors[] = {BLUEPLAYERCOLOR, REDPLAYERCOLOR, GREENPLAYERCOLOR, YELLOWPLAYERCOLOR};
+
+            return (colors[seat % (sizeof(colors) / sizeof(colors[0]))]);
+        }
+
         ////////////////////////////////////////////
         // Getters                                //
         ////////////////////////////////////////////
@@ -42,6 +51,11 @@ namespace indie
             return (this->_isPlaying);
         }
 
+        bool Player::getIsBot() const
+        {
+            return (this->_isBot);
+        }
+
         short unsigned int Player::getBombRadius() const
         {
             return (this->_bombRadius);
@@ -96,6 +110,11 @@ namespace indie
             this->_bombRadius = value;
         }
 
+        void Player::setIsBot(bool isBot)
+        {
+            this->_isBot = isBot;
+        }
+
         void Player::setBombStock(short unsigned int value)
         {
             this->_bombStock = value;
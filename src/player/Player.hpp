@@ -15,6 +15,14 @@
 #include "Vec2.hpp"
 
 #include <raylib.h>
+#include <cstddef>
+
+/// @brief Fewest players of a match
+#define MIN_PLAYERS 2
+/// @brief Most players of a match
+#define MAX_PLAYERS 64
+/// @brief Players of a match when no count is given
+#define DEFAULT_PLAYERS 4
 
 namespace indie
 {
@@ -50,6 +58,13 @@ namespace indie
 
             /// @brief Destroy the Player object
             ~Player() = default;
+            /**
+             * @brief Get the color of a seat, the four player colors repeat past the fourth seat
+             *
+             * @param seat Player index
+             * @return Color Color of the seat
+             */
+            static Color getSeatColor(std::size_t seat);
             /**
              * @brief Get if the player is alive or not.
              *
@@ -64,6 +79,12 @@ namespace indie
              * @return false Player is not playing
              */
             bool getIsPlaying() const;
+            /**
+             * @brief Get if the player is driven by a bot
+             *
+             * @return true If a bot plays it
+             */
+            bool getIsBot() const;
             /**
              * @brief Get the Controller Id
              *
@@ -109,6 +130,12 @@ namespace indie
              * @param isPlaying Player's state
              */
             void setIsPlaying(bool isPlaying);
+            /**
+             * @brief Set if the player is driven by a bot
+             *
+             * @param isBot A bot plays it
+             */
+            void setIsBot(bool isBot);
             /// Set the controllerId linked to the player.
             /// @param value new value.
             void setControllerId(short unsigned int value);
@@ -160,6 +187,8 @@ namespace indie
             bool _isAlive;
             /// @brief Is the player playing ?
             bool _isPlaying;
+            /// @brief Is the player driven by a bot ?
+            bool _isBot;
             /// Id of the controller linked to the player
             short unsigned int _controllerId;
             /// Bomb stock of the player
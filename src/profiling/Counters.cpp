@@ -0,0 +1,153 @@
+/**
+ * @file Counters.cpp
+ * @brief Per thread counters of the hot path events source file
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "Counters.hpp"
+#include <filesystem>
+#include <fstream>
+#include "../core/JobSystem.hpp"
+
+thread_local indie::profiling::Counters::Slots *indie::profiling::Counters::_local = nullptr;
+std::mutex indie::profiling::Counters::_lock;
+std::vector<std::unique_ptr<indie::profiling::Counters::Slots>> indie::profiling::Counters::_threads;
+std::array<std::uint64_t, indie::profiling::COUNTERS> indie::profiling::Counters::_totals = {};
+std::array<std::uint64_t, indie::profiling::COUNTERS> indie::profiling::Counters::_lastTick = {};
+std::array<std::uint64_t, indie::profiling::COUNTERS> indie::profiling::Counters::_peak = {};
+std::array<std::uint64_t, indie::profiling::COUNTERS> indie::profiling::Counters::_snapshotTotals = {};
+std::uint64_t indie::profiling::Counters::_ticks = 0;
+std::uint64_t indie::profiling::Counters::_snapshotTicks = 0;
+indie::core::JobSystem *indie::profiling::Counters::_jobs = nullptr;
+std::atomic<bool> indie::profiling::Counters::_writing(false);
+
+namespace
+{
+    /// @brief Metric name of each counter
+    constexpr const char *COUNTER_NAMES[indie::profiling::COUNTERS] = {"indie_get_component", "indie_dynamic_cast",
+        "indie_collision_tests", "indie_blast_lookups", "indie_entities_spawned", "indie_entities_destroyed",
+        "indie_texture_loads", "indie_model_loads", "indie_sound_loads", "indie_sim_mismatches"};
+} // namespace
+
+indie::profiling::Counters::Slots *indie::profiling::Counters::registerThread()
+{
+    std::unique_ptr<Slots> slots = std::make_unique<Slots>();
+    std::lock_guard<std::mutex> guard(_lock);
+
+    for (auto &slot : *slots)
+        slot.store(0, std::memory_order_relaxed);
+    _local = slots.get();
+    _threads.push_back(std::move(slots));
+    return (_local);
+}
+
+void indie::profiling::Counters::endTick(bool publish)
+{
+    std::array<std::uint64_t, COUNTERS> totals = {};
+    Snapshot snapshot = {};
+    bool due = false;
+
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        for (auto &slots : _threads)
+            for (std::size_t counter = 0; counter < COUNTERS; counter++)
+                totals[counter] += (*slots)[counter].load(std::memory_order_relaxed);
+        for (std::size_t counter = 0; counter < COUNTERS; counter++) {
+            _lastTick[counter] = totals[counter] - _totals[counter];
+            if (_lastTick[counter] > _peak[counter])
+                _peak[counter] = _lastTick[counter];
+        }
+        _totals = totals;
+        _ticks++;
+        // A snapshot still being written keeps the window open until the next tick
+        due = publish && _ticks - _snapshotTicks >= COUNTERS_SNAPSHOT_TICKS
+            && !_writing.load(std::memory_order_acquire);
+        if (due)
+            snapshot = takeSnapshot();
+    }
+    if (!due)
+        return;
+    if (_jobs == nullptr) {
+        write(snapshot, COUNTERS_PATH);
+        return;
+    }
+    _writing.store(true, std::memory_order_release);
+    _jobs->submit([snapshot]() {
+        write(snapshot, COUNTERS_PATH);
+        _writing.store(false, std::memory_order_release);
+    });
+}
+
+void indie::profiling::Counters::setJobSystem(indie::core::JobSystem *jobs)
+{
+    _jobs = jobs;
+}
+
+std::uint64_t indie::profiling::Counters::getTotal(Counter counter)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+
+    return (_totals[counter]);
+}
+
+std::uint64_t indie::profiling::Counters::getLastTick(Counter counter)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+
+    return (_lastTick[counter]);
+}
+
+bool indie::profiling::Counters::writeSnapshot(const std::string &path)
+{
+    Snapshot snapshot = {};
+
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        snapshot = takeSnapshot();
+    }
+    return (write(snapshot, path));
+}
+
+indie::profiling::Counters::Snapshot indie::profiling::Counters::takeSnapshot()
+{
+    Snapshot snapshot = {_ticks, _ticks - _snapshotTicks, _totals, _snapshotTotals, _peak};
+
+    // The window restarts even when the file cannot be written, so a failure is not retried every tick
+    _snapshotTotals = _totals;
+    _snapshotTicks = _ticks;
+    _peak.fill(0);
+    return (snapshot);
+}
+
+bool indie::profiling::Counters::write(const Snapshot &snapshot, const std::string &path)
+{
+    std::string temporary = path + ".tmp";
+    std::ofstream file(temporary, std::ios::out | std::ios::trunc);
+
+    if (!file.is_open())
+        return (false);
+    file << "# HELP indie_ticks_total Simulation ticks aggregated\n# TYPE indie_ticks_total counter\n"
+         << "indie_ticks_total " << snapshot.ticks << "\n";
+    for (std::size_t counter = 0; counter < COUNTERS; counter++) {
+        std::string name = COUNTER_NAMES[counter];
+        double perTick = snapshot.window == 0
+            ? 0.0
+            : static_cast<double>(snapshot.totals[counter] - snapshot.previousTotals[counter])
+                / static_cast<double>(snapshot.window);
+        file << "# TYPE " << name << "_total counter\n" << name << "_total " << snapshot.totals[counter] << "\n";
+        file << "# TYPE " << name << "_per_tick gauge\n" << name << "_per_tick " << perTick << "\n";
+        file << "# TYPE " << name << "_peak_per_tick gauge\n" << name << "_peak_per_tick " << snapshot.peak[counter]
+             << "\n";
+    }
+    file.close();
+    if (!file)
+        return (false);
+    std::error_code error;
+    // The scraper never sees a half written file
+    std::filesystem::rename(temporary, path, error);
+    return (!error);
+}
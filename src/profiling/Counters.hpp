@@ -0,0 +1,185 @@
+/**
+ * @file Counters.hpp
+ * @brief Per thread counters of the hot path events header file
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef COUNTERS_HPP_
+#define COUNTERS_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/// @brief Snapshot read by the monitoring scraper
+#define COUNTERS_PATH "counters.prom"
+/// @brief Ticks between two snapshots, a second of simulation
+#define COUNTERS_SNAPSHOT_TICKS 60
+
+#ifndef INDIE_NO_COUNTERS
+/// @brief Count one event
+#define COUNTER_INC(counter) indie::profiling::Counters::add(indie::profiling::counter)
+/// @brief Count several events
+#define COUNTER_ADD(counter, count) indie::profiling::Counters::add(indie::profiling::counter, count)
+#else
+#define COUNTER_INC(counter) ((void)0)
+#define COUNTER_ADD(counter, count) ((void)0)
+#endif
+
+namespace indie::core
+{
+    class JobSystem;
+} // namespace indie::core
+
+namespace indie::profiling
+{
+    /// @brief Counted events
+    enum Counter {
+        GET_COMPONENT,
+        DYNAMIC_CAST,
+        COLLISION_TESTS,
+        BLAST_LOOKUPS,
+        ENTITIES_SPAWNED,
+        ENTITIES_DESTROYED,
+        TEXTURE_LOADS,
+        MODEL_LOADS,
+        SOUND_LOADS,
+        SIM_MISMATCHES,
+        COUNTERS
+    };
+
+    /**
+     * @brief Registry of the event counters of every thread
+     *
+     * A thread only ever writes its own slots, with a relaxed load and store instead of a locked increment, so a count
+     * costs a couple of instructions. endTick sums the slots of every thread once per tick and a snapshot of the
+     * totals and per tick rates is written every COUNTERS_SNAPSHOT_TICKS ticks in the Prometheus text format.
+     *
+     * The tick only copies the aggregates for the snapshot, the file is written by a job on the workers so the
+     * measured frames carry no file access.
+     */
+    class Counters {
+      public:
+        /**
+         * @brief Count events on the calling thread
+         *
+         * @param counter Counted event
+         * @param count Number of events
+         */
+        static void add(Counter counter, std::uint64_t count = 1)
+        {
+            Slots *slots = _local;
+
+            if (slots == nullptr)
+                slots = registerThread();
+            std::atomic<std::uint64_t> &slot = (*slots)[counter];
+            slot.store(slot.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+        }
+        /**
+         * @brief Aggregate the counters of every thread at the end of a tick, writing the snapshot when it is due
+         *
+         * @param publish Whether the snapshot may be written on this tick, a due snapshot otherwise waits for the
+         * next tick that allows it
+         */
+        static void endTick(bool publish = true);
+        /**
+         * @brief Set the job system writing the snapshots
+         *
+         * @param jobs Job system, nullptr to write them on the thread ending the tick
+         */
+        static void setJobSystem(indie::core::JobSystem *jobs);
+        /**
+         * @brief Get the total of a counter at the last endTick
+         *
+         * @param counter Counted event
+         * @return std::uint64_t Events counted since the start
+         */
+        static std::uint64_t getTotal(Counter counter);
+        /**
+         * @brief Get the events of the last aggregated tick
+         *
+         * @param counter Counted event
+         * @return std::uint64_t Events of the tick
+         */
+        static std::uint64_t getLastTick(Counter counter);
+        /**
+         * @brief Write the snapshot, replacing the previous one atomically
+         *
+         * @param path Path of the snapshot
+         * @return true If the snapshot has been written
+         */
+        static bool writeSnapshot(const std::string &path = COUNTERS_PATH);
+
+      private:
+        /// @brief Counters of a thread
+        using Slots = std::array<std::atomic<std::uint64_t>, COUNTERS>;
+        /// @brief Aggregates copied for a snapshot
+        struct Snapshot {
+            /// @brief Ticks aggregated since the start
+            std::uint64_t ticks;
+            /// @brief Ticks since the previous snapshot
+            std::uint64_t window;
+            /// @brief Totals
+            std::array<std::uint64_t, COUNTERS> totals;
+            /// @brief Totals at the previous snapshot
+            std::array<std::uint64_t, COUNTERS> previousTotals;
+            /// @brief Most events in a tick since the previous snapshot
+            std::array<std::uint64_t, COUNTERS> peak;
+        };
+
+        /**
+         * @brief Create and register the slots of the calling thread
+         *
+         * @return Slots* The slots
+         */
+        static Slots *registerThread();
+        /**
+         * @brief Copy the aggregates and start a new snapshot window, _lock must be held
+         *
+         * @return Snapshot The copy
+         */
+        static Snapshot takeSnapshot();
+        /**
+         * @brief Write a snapshot, replacing the previous one atomically
+         *
+         * @param snapshot Aggregates copied by takeSnapshot
+         * @param path Path of the snapshot
+         * @return true If the snapshot has been written
+         */
+        static bool write(const Snapshot &snapshot, const std::string &path);
+
+        /// @brief Slots of the calling thread
+        static thread_local Slots *_local;
+        /// @brief Guards the registry and the aggregates
+        static std::mutex _lock;
+        /// @brief Slots of every thread, kept after the thread ends so the totals never go back
+        static std::vector<std::unique_ptr<Slots>> _threads;
+        /// @brief Totals at the last endTick
+        static std::array<std::uint64_t, COUNTERS> _totals;
+        /// @brief Events of the last tick
+        static std::array<std::uint64_t, COUNTERS> _lastTick;
+        /// @brief Most events in a tick since the last snapshot
+        static std::array<std::uint64_t, COUNTERS> _peak;
+        /// @brief Totals at the last snapshot
+        static std::array<std::uint64_t, COUNTERS> _snapshotTotals;
+        /// @brief Ticks aggregated since the start
+        static std::uint64_t _ticks;
+        /// @brief Ticks aggregated at the last snapshot
+        static std::uint64_t _snapshotTicks;
+        /// @brief Job system writing the snapshots, nullptr to write them on the thread ending the tick
+        static indie::core::JobSystem *_jobs;
+        /// @brief Set while a job writes a snapshot, the next one waits for it
+        static std::atomic<bool> _writing;
+    };
+} // namespace indie::profiling
+
+#endif /* !COUNTERS_HPP_ */
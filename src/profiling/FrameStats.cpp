@@ -0,0 +1,168 @@
+/**
+ * @file FrameStats.cpp
+ * @brief Rolling frame time and per system cost statistics source file
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "FrameStats.hpp"
+#include <algorithm>
+#include <cstdio>
+
+std::size_t indie::profiling::FrameStats::_drawCalls = 0;
+
+namespace
+{
+    /// @brief Name of each system, indexed by SystemType
+    constexpr const char *SYSTEM_NAMES[indie::profiling::FrameStats::SYSTEMS] = {
+        "draw3d", "draw2d", "movement", "collide", "sound", "explodable", "object", "input"};
+    /// @brief Systems shown on the overlay, the CSV has all of them
+    constexpr indie::ecs::system::SystemType OVERLAY_SYSTEMS[] = {indie::ecs::system::DRAWABLE2DSYSTEM,
+        indie::ecs::system::DRAWABLE3DSYSTEM, indie::ecs::system::MOVEMENTSYSTEM, indie::ecs::system::COLLIDESYSTEM,
+        indie::ecs::system::EXPLODABLESYSTEM, indie::ecs::system::OBJECTSYSTEM};
+} // namespace
+
+indie::profiling::FrameStats::FrameStats()
+    : _frames(), _count(0), _next(0), _current(), _lastEnd(), _frameNumber(0), _visible(false)
+{
+}
+
+indie::profiling::FrameStats::~FrameStats()
+{
+}
+
+void indie::profiling::FrameStats::addSystem(
+    indie::ecs::system::SystemType type, std::chrono::steady_clock::duration cost)
+{
+    if (static_cast<std::size_t>(type) < SYSTEMS)
+        this->_current.systems[type] += std::chrono::duration<double, std::milli>(cost).count();
+}
+
+void indie::profiling::FrameStats::countEntities(
+    const std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities)
+{
+    this->_current.entities.fill(0);
+    for (auto &entity : entities) {
+        std::size_t type = static_cast<std::size_t>(entity->getEntityType());
+        this->_current.entities[type < ENTITY_TYPES ? type : indie::ecs::entity::UNKNOWN]++;
+    }
+}
+
+void indie::profiling::FrameStats::countDrawCalls(std::size_t count)
+{
+    _drawCalls += count;
+}
+
+void indie::profiling::FrameStats::endFrame()
+{
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+    this->_current.drawCalls = _drawCalls;
+    _drawCalls = 0;
+    // The first frame has no start, it only opens the next one
+    if (this->_lastEnd) {
+        this->_current.time = std::chrono::duration<double, std::milli>(now - *this->_lastEnd).count();
+        this->_frames[this->_next] = this->_current;
+        this->_next = (this->_next + 1) % WINDOW;
+        if (this->_count < WINDOW)
+            this->_count++;
+        this->_frameNumber++;
+        if (this->_log.is_open())
+            log(this->_current);
+    }
+    this->_lastEnd = now;
+    this->_current = Frame();
+}
+
+double indie::profiling::FrameStats::getPercentile(double percent) const
+{
+    std::vector<double> sorted;
+
+    if (this->_count == 0)
+        return (0);
+    sorted.reserve(this->_count);
+    for (std::size_t i = 0; i < this->_count; i++)
+        sorted.push_back(this->_frames[i].time);
+    std::size_t rank = static_cast<std::size_t>(static_cast<double>(sorted.size()) * percent / 100.0);
+    if (rank >= sorted.size())
+        rank = sorted.size() - 1;
+    std::nth_element(sorted.begin(), sorted.begin() + rank, sorted.end());
+    return (sorted[rank]);
+}
+
+double indie::profiling::FrameStats::getSystemMean(indie::ecs::system::SystemType type) const
+{
+    double sum = 0;
+
+    if (this->_count == 0 || static_cast<std::size_t>(type) >= SYSTEMS)
+        return (0);
+    for (std::size_t i = 0; i < this->_count; i++)
+        sum += this->_frames[i].systems[type];
+    return (sum / this->_count);
+}
+
+std::string indie::profiling::FrameStats::toString() const
+{
+    const Frame &last = this->_frames[(this->_next + WINDOW - 1) % WINDOW];
+    std::string text;
+    char buffer[128];
+
+    std::snprintf(buffer, sizeof(buffer), "frame  p50 %.1f ms  p95 %.1f ms  p99 %.1f ms\n", getPercentile(50),
+        getPercentile(95), getPercentile(99));
+    text += buffer;
+    for (auto type : OVERLAY_SYSTEMS) {
+        std::snprintf(buffer, sizeof(buffer), "%-10s %.2f ms\n", SYSTEM_NAMES[type], getSystemMean(type));
+        text += buffer;
+    }
+    std::snprintf(buffer, sizeof(buffer), "players %zu  walls %zu  boxes %zu  bombs %zu  other %zu\ndraw calls %zu",
+        last.entities[indie::ecs::entity::PLAYER], last.entities[indie::ecs::entity::WALL],
+        last.entities[indie::ecs::entity::BOXES], last.entities[indie::ecs::entity::BOMB],
+        last.entities[indie::ecs::entity::TEXT] + last.entities[indie::ecs::entity::UNKNOWN], last.drawCalls);
+    text += buffer;
+    return (text);
+}
+
+void indie::profiling::FrameStats::log(const Frame &frame)
+{
+    this->_log << this->_frameNumber << ',' << frame.time;
+    for (auto cost : frame.systems)
+        this->_log << ',' << cost;
+    this->_log << ',' << frame.entities[indie::ecs::entity::PLAYER] << ',' << frame.entities[indie::ecs::entity::WALL]
+               << ',' << frame.entities[indie::ecs::entity::BOXES] << ',' << frame.entities[indie::ecs::entity::BOMB]
+               << ',' << frame.entities[indie::ecs::entity::TEXT] + frame.entities[indie::ecs::entity::UNKNOWN] << ','
+               << frame.drawCalls << '\n';
+}
+
+bool indie::profiling::FrameStats::toggleLog(const std::string &path)
+{
+    if (this->_log.is_open()) {
+        this->_log.close();
+        return (false);
+    }
+    this->_log.open(path, std::ios::out | std::ios::trunc);
+    if (!this->_log.is_open())
+        return (false);
+    this->_log << "frame,frame_ms";
+    for (auto name : SYSTEM_NAMES)
+        this->_log << ',' << name << "_ms";
+    this->_log << ",players,walls,boxes,bombs,other,draw_calls\n";
+    return (true);
+}
+
+bool indie::profiling::FrameStats::isLogging() const
+{
+    return (this->_log.is_open());
+}
+
+void indie::profiling::FrameStats::toggle()
+{
+    this->_visible = !this->_visible;
+}
+
+bool indie::profiling::FrameStats::isVisible() const
+{
+    return (this->_visible);
+}
@@ -0,0 +1,166 @@
+/**
+ * @file FrameStats.hpp
+ * @brief Rolling frame time and per system cost statistics header file
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef FRAMESTATS_HPP_
+#define FRAMESTATS_HPP_
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+#include "../ecs/entity/Entity.hpp"
+#include "../ecs/system/ISystem.hpp"
+
+/// @brief Per frame metrics written while logging is enabled
+#define FRAME_STATS_CSV_PATH "frames.csv"
+
+namespace indie::profiling
+{
+    /**
+     * @brief Rolling statistics of the last frames: frame time percentiles, cost of each system, entities and draws
+     *
+     * The systems report their cost and the render systems their draw calls during the frame, endFrame closes it.
+     * The same metrics can be appended to a CSV file, one line per frame.
+     */
+    class FrameStats {
+      public:
+        /// @brief Systems measured, indexed by SystemType
+        static constexpr std::size_t SYSTEMS = indie::ecs::system::INPUTSYSTEM + 1;
+        /// @brief Entity types counted, indexed by entityType
+        static constexpr std::size_t ENTITY_TYPES = indie::ecs::entity::UNKNOWN + 1;
+
+        /**
+         * @brief Construct a new FrameStats object
+         *
+         */
+        FrameStats();
+        /**
+         * @brief Destroy the FrameStats object, closing the log
+         *
+         */
+        ~FrameStats();
+        /**
+         * @brief Add the cost of a system to the current frame
+         *
+         * @param type Type of the system
+         * @param cost Time spent in its update
+         */
+        void addSystem(indie::ecs::system::SystemType type, std::chrono::steady_clock::duration cost);
+        /**
+         * @brief Count the entities of the current frame by type
+         *
+         * @param entities Entities of the screen
+         */
+        void countEntities(const std::vector<std::unique_ptr<indie::ecs::entity::Entity>> &entities);
+        /**
+         * @brief Count a draw call of the current frame, called by the render systems
+         *
+         * @param count Draw calls submitted
+         */
+        static void countDrawCalls(std::size_t count = 1);
+        /**
+         * @brief Close the current frame, its time is measured from the end of the previous one
+         *
+         */
+        void endFrame();
+        /**
+         * @brief Percentile of the frame times of the window, in milliseconds
+         *
+         * @param percent Percentile, between 0 and 100
+         * @return double Frame time
+         */
+        double getPercentile(double percent) const;
+        /**
+         * @brief Mean cost of a system over the window, in milliseconds
+         *
+         * @param type Type of the system
+         * @return double Mean cost
+         */
+        double getSystemMean(indie::ecs::system::SystemType type) const;
+        /**
+         * @brief Format the statistics for the overlay, one line per group
+         *
+         * @return std::string The overlay text
+         */
+        std::string toString() const;
+        /**
+         * @brief Show or hide the overlay
+         *
+         */
+        void toggle();
+        /**
+         * @brief Is the overlay shown?
+         *
+         * @return true If the overlay must be drawn
+         */
+        bool isVisible() const;
+        /**
+         * @brief Start or stop appending the metrics of each frame to a CSV file
+         *
+         * @param path Path of the CSV file, truncated when logging starts
+         * @return true If logging is enabled after the call
+         */
+        bool toggleLog(const std::string &path = FRAME_STATS_CSV_PATH);
+        /**
+         * @brief Is a CSV log being written?
+         *
+         * @return true If logging
+         */
+        bool isLogging() const;
+
+      private:
+        /// @brief Number of frames kept
+        static constexpr std::size_t WINDOW = 240;
+
+        /// @brief Metrics of a frame
+        struct Frame {
+            /// @brief Time since the previous frame, in milliseconds
+            double time;
+            /// @brief Cost of each system, in milliseconds
+            std::array<double, SYSTEMS> systems;
+            /// @brief Entities of each type
+            std::array<std::size_t, ENTITY_TYPES> entities;
+            /// @brief Draw calls submitted
+            std::size_t drawCalls;
+        };
+
+        /**
+         * @brief Append a frame to the CSV log
+         *
+         * @param frame The frame
+         */
+        void log(const Frame &frame);
+
+        /// @brief Last frames, used as a ring
+        std::array<Frame, WINDOW> _frames;
+        /// @brief Number of valid frames
+        std::size_t _count;
+        /// @brief Index of the next frame
+        std::size_t _next;
+        /// @brief Frame being measured
+        Frame _current;
+        /// @brief End of the previous frame
+        std::optional<std::chrono::steady_clock::time_point> _lastEnd;
+        /// @brief Frames closed since the start, first column of the log
+        std::size_t _frameNumber;
+        /// @brief CSV log
+        std::ofstream _log;
+        /// @brief Is the overlay shown?
+        bool _visible;
+        /// @brief Draw calls of the current frame
+        static std::size_t _drawCalls;
+    };
+} // namespace indie::profiling
+
+#endif /* !FRAMESTATS_HPP_ */
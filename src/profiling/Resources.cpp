@@ -0,0 +1,124 @@
+/**
+ * @file Resources.cpp
+ * @brief Accounting of the live GPU and audio resources source file
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "Resources.hpp"
+#include <string_view>
+#include <tuple>
+
+std::mutex indie::profiling::Resources::_lock;
+std::map<std::pair<indie::profiling::Resource, std::uintptr_t>, indie::profiling::Resources::Allocation>
+    indie::profiling::Resources::_live;
+std::array<std::size_t, indie::profiling::RESOURCES> indie::profiling::Resources::_count = {};
+std::array<std::size_t, indie::profiling::RESOURCES> indie::profiling::Resources::_bytes = {};
+std::array<std::size_t, indie::profiling::RESOURCES> indie::profiling::Resources::_markCount = {};
+std::array<std::size_t, indie::profiling::RESOURCES> indie::profiling::Resources::_markBytes = {};
+std::uint64_t indie::profiling::Resources::_serial = 0;
+std::uint64_t indie::profiling::Resources::_markSerial = 0;
+
+namespace
+{
+    /// @brief Printed name of each resource
+    constexpr const char *RESOURCE_NAMES[indie::profiling::RESOURCES] = {
+        "textures", "models", "animations", "sounds", "musics"};
+
+    /**
+     * @brief Print the difference of two sizes with its sign
+     *
+     * @param out Stream to print to
+     * @param now Current size
+     * @param before Size at the baseline
+     */
+    void printDelta(std::ostream &out, std::size_t now, std::size_t before)
+    {
+        if (now >= before)
+            out << "+" << now - before;
+        else
+            out << "-" << before - now;
+    }
+} // namespace
+
+void indie::profiling::Resources::track(
+    Resource resource, std::uintptr_t handle, std::size_t bytes, const std::source_location &site)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    auto [it, inserted] = _live.try_emplace({resource, handle}, Allocation{bytes, site.file_name(), site.line(), 0});
+
+    // A handle still recorded was freed behind the wrappers, the new load replaces it
+    if (!inserted) {
+        _count[resource]--;
+        _bytes[resource] -= it->second.bytes;
+        it->second = Allocation{bytes, site.file_name(), site.line(), 0};
+    }
+    it->second.serial = _serial++;
+    _count[resource]++;
+    _bytes[resource] += bytes;
+}
+
+void indie::profiling::Resources::untrack(Resource resource, std::uintptr_t handle)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    auto it = _live.find({resource, handle});
+
+    if (it == _live.end())
+        return;
+    _count[resource]--;
+    _bytes[resource] -= it->second.bytes;
+    _live.erase(it);
+}
+
+std::size_t indie::profiling::Resources::getLive(Resource resource)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+
+    return (_count[resource]);
+}
+
+std::size_t indie::profiling::Resources::getBytes(Resource resource)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+
+    return (_bytes[resource]);
+}
+
+void indie::profiling::Resources::mark()
+{
+    std::lock_guard<std::mutex> guard(_lock);
+
+    _markCount = _count;
+    _markBytes = _bytes;
+    _markSerial = _serial;
+}
+
+bool indie::profiling::Resources::report(std::ostream &out)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    std::map<std::tuple<std::string_view, std::uint_least32_t, Resource>, std::pair<std::size_t, std::size_t>> sites;
+
+    out << "Resources:";
+    for (std::size_t resource = 0; resource < RESOURCES; resource++) {
+        out << " " << RESOURCE_NAMES[resource] << " " << _count[resource] << " (";
+        printDelta(out, _count[resource], _markCount[resource]);
+        out << ") " << _bytes[resource] << " B (";
+        printDelta(out, _bytes[resource], _markBytes[resource]);
+        out << " B)" << (resource + 1 < RESOURCES ? "," : "\n");
+    }
+    for (auto &[key, allocation] : _live) {
+        if (allocation.serial < _markSerial)
+            continue;
+        std::string_view file = allocation.file;
+        auto &site = sites[{file.substr(file.find_last_of('/') + 1), allocation.line, key.first}];
+        site.first++;
+        site.second += allocation.bytes;
+    }
+    for (auto &[site, total] : sites)
+        out << "  still alive from " << std::get<0>(site) << ":" << std::get<1>(site) << " "
+            << RESOURCE_NAMES[std::get<2>(site)] << " x" << total.first << " " << total.second << " B\n";
+    return (sites.empty());
+}
@@ -0,0 +1,112 @@
+/**
+ * @file Resources.hpp
+ * @brief Accounting of the live GPU and audio resources header file
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RESOURCES_HPP_
+#define RESOURCES_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <source_location>
+#include <utility>
+
+namespace indie::profiling
+{
+    /// @brief Accounted resources
+    enum Resource { TEXTURE, MODEL, ANIMATION, SOUND, MUSIC, RESOURCES };
+
+    /**
+     * @brief Registry of the resources loaded through the raylib wrappers
+     *
+     * Each load is recorded with its size and the call site of the wrapper, each unload forgets it. mark takes a
+     * baseline and report prints what changed since, listing by call site the resources loaded after the baseline and
+     * still alive: called between two matches, that list is the leak of the match.
+     */
+    class Resources {
+      public:
+        /**
+         * @brief Record a loaded resource
+         *
+         * @param resource Kind of the resource
+         * @param handle Value telling the resource apart from the live ones of its kind
+         * @param bytes Estimated memory of the resource
+         * @param site Code that loaded it
+         */
+        static void track(Resource resource, std::uintptr_t handle, std::size_t bytes, const std::source_location &site);
+        /**
+         * @brief Forget an unloaded resource, unknown handles are ignored
+         *
+         * @param resource Kind of the resource
+         * @param handle Value given to track
+         */
+        static void untrack(Resource resource, std::uintptr_t handle);
+        /**
+         * @brief Get the number of live resources of a kind
+         *
+         * @param resource Kind of the resources
+         * @return std::size_t Live resources
+         */
+        static std::size_t getLive(Resource resource);
+        /**
+         * @brief Get the estimated memory of the live resources of a kind
+         *
+         * @param resource Kind of the resources
+         * @return std::size_t Bytes
+         */
+        static std::size_t getBytes(Resource resource);
+        /**
+         * @brief Take the live resources as the baseline of the next report
+         *
+         */
+        static void mark();
+        /**
+         * @brief Print the live resources, their change since the baseline and the sites of the new ones
+         *
+         * @param out Stream to print to
+         * @return true If nothing loaded since the baseline is alive
+         */
+        static bool report(std::ostream &out);
+
+      private:
+        /// @brief A live resource
+        struct Allocation {
+            /// @brief Estimated memory
+            std::size_t bytes;
+            /// @brief File of the code that loaded it
+            const char *file;
+            /// @brief Line of the code that loaded it
+            std::uint_least32_t line;
+            /// @brief Order of the load
+            std::uint64_t serial;
+        };
+
+        /// @brief Guards the registry, resources may be loaded off the main thread
+        static std::mutex _lock;
+        /// @brief Live resources by kind and handle
+        static std::map<std::pair<Resource, std::uintptr_t>, Allocation> _live;
+        /// @brief Number of live resources of each kind
+        static std::array<std::size_t, RESOURCES> _count;
+        /// @brief Memory of the live resources of each kind
+        static std::array<std::size_t, RESOURCES> _bytes;
+        /// @brief Counts at the baseline
+        static std::array<std::size_t, RESOURCES> _markCount;
+        /// @brief Memory at the baseline
+        static std::array<std::size_t, RESOURCES> _markBytes;
+        /// @brief Serial of the next load
+        static std::uint64_t _serial;
+        /// @brief First serial loaded after the baseline
+        static std::uint64_t _markSerial;
+    };
+} // namespace indie::profiling
+
+#endif /* !RESOURCES_HPP_ */
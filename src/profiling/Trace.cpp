@@ -0,0 +1,135 @@
+/**
+ * @file Trace.cpp
+ * @brief Scoped timing zones exported as Chrome trace events source file
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "Trace.hpp"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+std::atomic<bool> indie::profiling::Trace::_enabled(true);
+std::mutex indie::profiling::Trace::_registryLock;
+std::vector<std::shared_ptr<indie::profiling::Trace::Buffer>> indie::profiling::Trace::_buffers;
+const std::chrono::steady_clock::time_point indie::profiling::Trace::_origin = std::chrono::steady_clock::now();
+
+namespace
+{
+    /// @brief Write a string as a JSON string literal
+    void writeString(std::ofstream &file, const std::string &text)
+    {
+        file << '"';
+        for (char c : text) {
+            if (c == '"' || c == '\\')
+                file << '\\';
+            if (static_cast<unsigned char>(c) >= 0x20)
+                file << c;
+        }
+        file << '"';
+    }
+} // namespace
+
+indie::profiling::Trace::Buffer &indie::profiling::Trace::local()
+{
+    thread_local std::shared_ptr<Buffer> buffer;
+    static std::uint32_t nextTid = 1;
+
+    if (buffer == nullptr) {
+        buffer = std::make_shared<Buffer>();
+        std::lock_guard<std::mutex> guard(_registryLock);
+        buffer->tid = nextTid++;
+        _buffers.push_back(buffer);
+    }
+    return (*buffer);
+}
+
+void indie::profiling::Trace::record(
+    const char *name, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+{
+    Buffer &buffer = local();
+    std::lock_guard<std::mutex> guard(buffer.lock);
+
+    buffer.events[buffer.count % TRACE_THREAD_EVENTS] = {name,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(start - _origin).count(),
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()};
+    buffer.count++;
+}
+
+void indie::profiling::Trace::setThreadName(const std::string &name)
+{
+    Buffer &buffer = local();
+    std::lock_guard<std::mutex> guard(buffer.lock);
+
+    buffer.name = name;
+}
+
+void indie::profiling::Trace::setEnabled(bool enabled)
+{
+    _enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool indie::profiling::Trace::isEnabled()
+{
+    return (_enabled.load(std::memory_order_relaxed));
+}
+
+bool indie::profiling::Trace::dump(const std::string &path)
+{
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    std::vector<Event> events;
+    bool first = true;
+
+    if (!file.is_open())
+        return (false);
+    // Microseconds with a nanosecond fraction, never in scientific notation
+    file << std::fixed << std::setprecision(3);
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    std::lock_guard<std::mutex> registry(_registryLock);
+    for (auto &buffer : _buffers) {
+        std::uint32_t tid = 0;
+        std::string name;
+        {
+            // Copy the ring out, the thread keeps recording while the file is written
+            std::lock_guard<std::mutex> guard(buffer->lock);
+            std::uint64_t kept = std::min<std::uint64_t>(buffer->count, TRACE_THREAD_EVENTS);
+            events.clear();
+            for (std::uint64_t index = buffer->count - kept; index < buffer->count; index++)
+                events.push_back(buffer->events[index % TRACE_THREAD_EVENTS]);
+            tid = buffer->tid;
+            name = buffer->name.empty() ? "thread " + std::to_string(tid) : buffer->name;
+        }
+        file << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << tid
+             << ",\"args\":{\"name\":";
+        writeString(file, name);
+        file << "}}";
+        first = false;
+        for (auto &event : events) {
+            file << ",\n{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << tid
+                 << ",\"ts\":" << static_cast<double>(event.start) / 1000.0
+                 << ",\"dur\":" << static_cast<double>(event.duration) / 1000.0 << "}";
+        }
+    }
+    // Only the registry still holds the rings of the finished threads
+    _buffers.erase(std::remove_if(_buffers.begin(), _buffers.end(),
+                       [](const std::shared_ptr<Buffer> &buffer) { return (buffer.use_count() == 1); }),
+        _buffers.end());
+    file << "\n]}\n";
+    return (file.good());
+}
+
+indie::profiling::Zone::Zone(const char *name) : _name(name), _start()
+{
+    if (Trace::isEnabled())
+        this->_start = std::chrono::steady_clock::now();
+}
+
+indie::profiling::Zone::~Zone()
+{
+    if (this->_start != std::chrono::steady_clock::time_point())
+        Trace::record(this->_name, this->_start, std::chrono::steady_clock::now());
+}
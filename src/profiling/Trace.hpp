@@ -0,0 +1,154 @@
+/**
+ * @file Trace.hpp
+ * @brief Scoped timing zones exported as Chrome trace events header file
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef TRACE_HPP_
+#define TRACE_HPP_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/// @brief Zones kept by each thread, the oldest ones are overwritten (about 10 s of frames at 60 FPS)
+#define TRACE_THREAD_EVENTS 16384
+/// @brief Trace written by Trace::dump when no path is given
+#define TRACE_PATH "trace.json"
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+
+#ifndef INDIE_NO_TRACE
+/// @brief Time the rest of the enclosing scope, name must be a string literal
+#define TRACE_ZONE(name) indie::profiling::Zone TRACE_CONCAT(_traceZone, __LINE__)(name)
+#else
+#define TRACE_ZONE(name)
+#endif
+
+namespace indie::profiling
+{
+    /**
+     * @brief Recorder of the timing zones of every thread
+     *
+     * Each thread writes its zones to its own ring, so recording never contends with the other threads: the lock of a
+     * ring is only shared with dump. The rings outlive their threads until the next dump, which writes the last
+     * TRACE_THREAD_EVENTS zones of every thread as a Chrome trace-event file (chrome://tracing, ui.perfetto.dev).
+     */
+    class Trace {
+      public:
+        /**
+         * @brief Record a finished zone on the calling thread
+         *
+         * @param name Static name of the zone
+         * @param start Start of the zone
+         * @param end End of the zone
+         */
+        static void record(const char *name, std::chrono::steady_clock::time_point start,
+            std::chrono::steady_clock::time_point end);
+        /**
+         * @brief Name the calling thread in the trace
+         *
+         * @param name Name of the thread
+         */
+        static void setThreadName(const std::string &name);
+        /**
+         * @brief Start or stop recording, zones are dropped while disabled
+         *
+         * @param enabled Record the zones
+         */
+        static void setEnabled(bool enabled);
+        /**
+         * @brief Is recording enabled?
+         *
+         * @return true If the zones are recorded
+         */
+        static bool isEnabled();
+        /**
+         * @brief Write the recorded zones of every thread as Chrome trace-event JSON
+         *
+         * @param path Path of the trace file
+         * @return true If the file has been written
+         */
+        static bool dump(const std::string &path = TRACE_PATH);
+
+      private:
+        /// @brief A finished zone
+        struct Event {
+            /// @brief Static name of the zone
+            const char *name;
+            /// @brief Start, in nanoseconds since the start of the trace
+            std::int64_t start;
+            /// @brief Duration, in nanoseconds
+            std::int64_t duration;
+        };
+        /// @brief Ring of the zones of a thread
+        struct Buffer {
+            /// @brief Guards the ring against a concurrent dump
+            std::mutex lock;
+            /// @brief Id of the thread in the trace
+            std::uint32_t tid = 0;
+            /// @brief Name of the thread
+            std::string name;
+            /// @brief Zones written so far, the ring holds the last TRACE_THREAD_EVENTS
+            std::uint64_t count = 0;
+            /// @brief Recorded zones
+            std::array<Event, TRACE_THREAD_EVENTS> events;
+        };
+
+        /**
+         * @brief Get the ring of the calling thread, registering it on first use
+         *
+         * @return Buffer& The ring
+         */
+        static Buffer &local();
+
+        /// @brief Is recording enabled?
+        static std::atomic<bool> _enabled;
+        /// @brief Guards the registry of rings
+        static std::mutex _registryLock;
+        /// @brief Ring of every thread that recorded a zone
+        static std::vector<std::shared_ptr<Buffer>> _buffers;
+        /// @brief Origin of the timestamps
+        static const std::chrono::steady_clock::time_point _origin;
+    };
+
+    /**
+     * @brief Times a scope and records it when the scope ends
+     *
+     */
+    class Zone {
+      public:
+        /**
+         * @brief Start the zone
+         *
+         * @param name Static name of the zone
+         */
+        explicit Zone(const char *name);
+        /**
+         * @brief End and record the zone
+         *
+         */
+        ~Zone();
+        Zone(const Zone &) = delete;
+        Zone &operator=(const Zone &) = delete;
+
+      private:
+        /// @brief Static name of the zone
+        const char *_name;
+        /// @brief Start of the zone, unset when recording is disabled
+        std::chrono::steady_clock::time_point _start;
+    };
+} // namespace indie::profiling
+
+#endif /* !TRACE_HPP_ */
@@ -56,7 +56,7 @@ void indie::raylib::Draw::setColor(::Color color)
     _color = color;
 }
 
-void indie::raylib::Draw::drawText(const std::string text)
+void indie::raylib::Draw::drawText(const std::string &text)
 {
     ::DrawText(text.c_str(), _posX, _posY, _fontSize, _color);
 }
@@ -89,7 +89,7 @@ namespace indie
              * 
              * @param text Text to draw
              */
-            void drawText(const std::string text);
+            void drawText(const std::string &text);
             /**
              * @brief Draw current FPS
              */
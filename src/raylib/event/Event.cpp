@@ -16,6 +16,11 @@ bool indie::raylib::Event::isKeyPressed(KeyboardKey key)
     return (IsKeyPressed(key));
 }
 
+int indie::raylib::Event::getKeyPressed()
+{
+    return ::GetKeyPressed();
+}
+
 bool indie::raylib::Event::isGamepadAvailable(int gamepad)
 {
     return ::IsGamepadAvailable(gamepad);
@@ -40,6 +40,12 @@ namespace indie
              * @return false The key isn't pressed
              */
             static bool isKeyPressed(KeyboardKey key);
+            /**
+             * @brief Get the next key pressed this frame, call it repeatedly to empty the queue
+             *
+             * @return int The key code, 0 when no key is left
+             */
+            static int getKeyPressed();
             // Input-related functions: gamepads
             /**
              * @brief Check if a gamepad is available
@@ -6,15 +6,45 @@
 */
 
 #include "Model.hpp"
+#include "../../profiling/Counters.hpp"
+#include "../../profiling/Resources.hpp"
+#include <cstdint>
 
-::Model indie::raylib::Model::load(const char *fileName)
+namespace
 {
-    return ::LoadModel(fileName);
+    /**
+     * @brief Account a loaded model
+     *
+     * The size counts positions, texture coordinates, normals and 16 bit indices of the meshes, plus the skeleton.
+     *
+     * @param model The model, nothing is recorded when the load failed
+     * @param site Code that loaded it
+     * @return ::Model The model
+     */
+    ::Model track(::Model model, const std::source_location &site)
+    {
+        std::size_t bytes = static_cast<std::size_t>(model.boneCount) * (sizeof(::BoneInfo) + sizeof(::Transform));
+
+        if (model.meshes == nullptr)
+            return (model);
+        for (int mesh = 0; mesh < model.meshCount; mesh++)
+            bytes += static_cast<std::size_t>(model.meshes[mesh].vertexCount) * 8 * sizeof(float)
+                + static_cast<std::size_t>(model.meshes[mesh].triangleCount) * 3 * sizeof(unsigned short);
+        indie::profiling::Resources::track(
+            indie::profiling::MODEL, reinterpret_cast<std::uintptr_t>(model.meshes), bytes, site);
+        return (model);
+    }
+} // namespace
+
+::Model indie::raylib::Model::load(const char *fileName, const std::source_location &site)
+{
+    COUNTER_INC(MODEL_LOADS);
+    return track(::LoadModel(fileName), site);
 }
 
-::Model indie::raylib::Model::loadFromMesh(::Mesh mesh)
+::Model indie::raylib::Model::loadFromMesh(::Mesh mesh, const std::source_location &site)
 {
-    return ::LoadModelFromMesh(mesh);
+    return track(::LoadModelFromMesh(mesh), site);
 }
 
 void indie::raylib::Model::updateModelAnimation(::Model model, ::ModelAnimation anim, int frame)
@@ -29,21 +59,38 @@ void indie::raylib::Model::setMaterialTexture(::Material *material, int mapType,
 
 void indie::raylib::Model::unload(::Model model)
 {
+    indie::profiling::Resources::untrack(indie::profiling::MODEL, reinterpret_cast<std::uintptr_t>(model.meshes));
     ::UnloadModel(model);
 }
 
 void indie::raylib::Model::unloadKeepMeshes(::Model model)
 {
+    // The meshes kept belong to the caller from now on
+    indie::profiling::Resources::untrack(indie::profiling::MODEL, reinterpret_cast<std::uintptr_t>(model.meshes));
     ::UnloadModelKeepMeshes(model);
 }
 
-::ModelAnimation *indie::raylib::Model::loadAnimation(const char *fileName, unsigned int *animsCount)
+::ModelAnimation *indie::raylib::Model::loadAnimation(
+    const char *fileName, unsigned int *animsCount, const std::source_location &site)
 {
-    return ::LoadModelAnimations(fileName, animsCount);
+    COUNTER_INC(MODEL_LOADS);
+    ::ModelAnimation *animations = ::LoadModelAnimations(fileName, animsCount);
+    std::size_t bytes = 0;
+
+    if (animations == nullptr)
+        return (animations);
+    for (unsigned int animation = 0; animation < *animsCount; animation++)
+        bytes += static_cast<std::size_t>(animations[animation].boneCount)
+            * (sizeof(::BoneInfo)
+                + static_cast<std::size_t>(animations[animation].frameCount) * sizeof(::Transform));
+    indie::profiling::Resources::track(
+        indie::profiling::ANIMATION, reinterpret_cast<std::uintptr_t>(animations), bytes, site);
+    return (animations);
 }
 
 void indie::raylib::Model::unloadModelAnimations(::ModelAnimation *animations, unsigned int count)
 {
+    indie::profiling::Resources::untrack(indie::profiling::ANIMATION, reinterpret_cast<std::uintptr_t>(animations));
     ::UnloadModelAnimations(animations, count);
 }
 
@@ -8,6 +8,7 @@
 #ifndef MODEL_HPP_
 #define MODEL_HPP_
 
+#include <source_location>
 #include "../Raylib.hpp"
 
 namespace indie
@@ -34,27 +35,33 @@ namespace indie
              * @brief Load model from files (meshes and materials)
              *
              * @param fileName Filepath to the model file
+             * @param site Code loading it, for the resource accounting
              *
              * @return Model Model object
              */
-            static ::Model load(const char *fileName);
+            static ::Model load(
+                const char *fileName, const std::source_location &site = std::source_location::current());
             /**
              * @brief Load model from generated mesh (default material)
              *
              * @param mesh Mesh to load
+             * @param site Code loading it, for the resource accounting
              *
              * @return Model Model object
              */
-            static ::Model loadFromMesh(::Mesh mesh);
+            static ::Model loadFromMesh(
+                ::Mesh mesh, const std::source_location &site = std::source_location::current());
 
             /**
              * @brief Load animations file
              *
              * @param fileName file containing animations
              * @param animsCount pointer to integer where will be stored the number of animations
+             * @param site Code loading it, for the resource accounting
              * @return ::ModelAnimation Array Model animation loaded
              */
-            static ::ModelAnimation *loadAnimation(const char *fileName, unsigned int *animsCount);
+            static ::ModelAnimation *loadAnimation(const char *fileName, unsigned int *animsCount,
+                const std::source_location &site = std::source_location::current());
             /**
              * @brief Unload model (including meshes) from memory (RAM and/or VRAM)
              *
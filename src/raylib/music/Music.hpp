@@ -12,6 +12,7 @@
 #ifndef MUSIC_HPP_
 #define MUSIC_HPP_
 
+#include <source_location>
 #include "../Raylib.hpp"
 
 namespace indie
@@ -25,8 +26,9 @@ namespace indie
              * @brief Construct a new Music object
              * 
              * @param fileName Filepath to the music file
+             * @param site Code loading it, for the resource accounting
              */
-            Music(const std::string &fileName);
+            Music(const std::string &fileName, const std::source_location &site = std::source_location::current());
             /**
              * @brief Destroy the Music object
              * 
@@ -36,20 +38,24 @@ namespace indie
              * @brief Load music stream from file
              * 
              * @param fileName Filepath to the music file
+             * @param site Code loading it, for the resource accounting
              * 
              * @return Music The music stream
              */
-            static ::Music loadStream(const std::string &fileName);
+            static ::Music loadStream(
+                const std::string &fileName, const std::source_location &site = std::source_location::current());
             /**
              * @brief Load music stream from data
              * 
              * @param fileType The type of file
              * @param data The data to load
              * @param dataSize The data size to load
+             * @param site Code loading it, for the resource accounting
              * 
              * @return Music The music stream
              */
-            static ::Music loadStreamFromMemory(const std::string &fileType, unsigned char *data, int dataSize);
+            static ::Music loadStreamFromMemory(const std::string &fileType, unsigned char *data, int dataSize,
+                const std::source_location &site = std::source_location::current());
             /**
              * @brief Unload Music stream
              * 
@@ -199,6 +205,18 @@ namespace indie
              * @return float The music time played
              */
             float getTimePlayed(void);
+            /**
+             * @brief Set whether the music restarts when it ends
+             * 
+             * @param looping True to loop
+             */
+            void setLooping(bool looping);
+            /**
+             * @brief Set the size of the buffers of the streams loaded from now on
+             * 
+             * @param frames Size in frames, raylib keeps two buffers of this size per stream
+             */
+            static void setStreamBufferSize(int frames);
 
           private:
             /**
@@ -10,10 +10,43 @@
  */
 
 #include "Sound.hpp"
-
-indie::raylib::Sound::Sound(const std::string &fileName) : _volume(1)
-{
-    _sound = ::LoadSound(fileName.c_str());
+#include <cstdint>
+#include "../../profiling/Resources.hpp"
+
+namespace
+{
+    /**
+     * @brief Account a loaded sound
+     *
+     * @param sound The sound, nothing is recorded when the load failed
+     * @param site Code that loaded it
+     * @return ::Sound The sound
+     */
+    ::Sound track(::Sound sound, const std::source_location &site)
+    {
+        if (sound.stream.buffer == nullptr)
+            return (sound);
+        indie::profiling::Resources::track(indie::profiling::SOUND,
+            reinterpret_cast<std::uintptr_t>(sound.stream.buffer),
+            static_cast<std::size_t>(sound.frameCount) * sound.stream.channels * sound.stream.sampleSize / 8, site);
+        return (sound);
+    }
+
+    /**
+     * @brief Forget an unloaded sound
+     *
+     * @param sound The sound
+     */
+    void untrack(::Sound sound)
+    {
+        indie::profiling::Resources::untrack(
+            indie::profiling::SOUND, reinterpret_cast<std::uintptr_t>(sound.stream.buffer));
+    }
+} // namespace
+
+indie::raylib::Sound::Sound(const std::string &fileName, const std::source_location &site) : _volume(1)
+{
+    _sound = track(::LoadSound(fileName.c_str()), site);
 }
 
 ::Sound indie::raylib::Sound::getSound() const
@@ -26,9 +59,24 @@ void indie::raylib::Sound::initAudioDevice()
     ::InitAudioDevice();
 }
 
-::Sound indie::raylib::Sound::load(const char *fileName)
+::Sound indie::raylib::Sound::load(const char *fileName, const std::source_location &site)
 {
-    return ::LoadSound(fileName);
+    return track(::LoadSound(fileName), site);
+}
+
+::Wave indie::raylib::Sound::loadWave(const std::string &fileName)
+{
+    return ::LoadWave(fileName.c_str());
+}
+
+::Sound indie::raylib::Sound::loadFromWave(::Wave wave, const std::source_location &site)
+{
+    return track(::LoadSoundFromWave(wave), site);
+}
+
+void indie::raylib::Sound::unloadWave(::Wave wave)
+{
+    ::UnloadWave(wave);
 }
 
 void indie::raylib::Sound::update(::Sound sound, const void *data, int samplesCount)
@@ -38,11 +86,13 @@ void indie::raylib::Sound::update(::Sound sound, const void *data, int samplesCo
 
 void indie::raylib::Sound::unload(::Sound sound)
 {
+    untrack(sound);
     ::UnloadSound(sound);
 }
 
 void indie::raylib::Sound::unload()
 {
+    untrack(_sound);
     ::UnloadSound(_sound);
 }
 
@@ -90,11 +140,10 @@ float indie::raylib::Sound::getVolume() const
     return _volume;
 }
 
-// void indie::raylib::Sound::setVolume(::Sound sound, float volume)
-// {
-//     ::SetSoundVolume(sound, volume);
-//     _volume = volume;
-// }
+void indie::raylib::Sound::setVolume(::Sound sound, float volume)
+{
+    ::SetSoundVolume(sound, volume);
+}
 
 void indie::raylib::Sound::setVolume(float volume)
 {
@@ -12,6 +12,7 @@
 #ifndef SOUND_HPP_
 #define SOUND_HPP_
 
+#include <source_location>
 #include "../Raylib.hpp"
 
 namespace indie
@@ -30,8 +31,10 @@ namespace indie
                  * @brief Construct a new Sound object
                  * 
                  * @param fileName File path to the sound file
+                 * @param site Code loading it, for the resource accounting
                  */
-                Sound(const std::string& fileName);
+                Sound(const std::string& fileName,
+                    const std::source_location &site = std::source_location::current());
                 /**
                  * @brief Destroy the Sound object
                  * 
@@ -51,10 +54,36 @@ namespace indie
                 * @brief Load sound from file
                 * 
                 * @param fileName File path to the sound file
+                * @param site Code loading it, for the resource accounting
                 * 
                 * @return Sound Sound object
                 */
-                ::Sound load(const char *fileName);
+                ::Sound load(
+                    const char *fileName, const std::source_location &site = std::source_location::current());
+                /**
+                * @brief Decode a sound file into memory
+                * 
+                * @param fileName File path to the sound file
+                * 
+                * @return Wave Decoded samples
+                */
+                static ::Wave loadWave(const std::string &fileName);
+                /**
+                * @brief Load a sound from decoded samples, without any file access
+                * 
+                * @param wave Decoded samples
+                * @param site Code loading it, for the resource accounting
+                * 
+                * @return Sound Sound object
+                */
+                static ::Sound loadFromWave(
+                    ::Wave wave, const std::source_location &site = std::source_location::current());
+                /**
+                * @brief Unload decoded samples
+                * 
+                * @param wave Decoded samples
+                */
+                static void unloadWave(::Wave wave);
                 /**
                 * @brief Update sound buffer with new data
                 * 
@@ -130,6 +159,13 @@ namespace indie
                 * @param volume The volume for the sound
                 */
                 void setVolume(float volume);
+                /**
+                 * @brief Set the volume of a sound
+                 * 
+                 * @param sound The sound stream
+                 * @param volume Volume, from 0 to 1
+                 */
+                static void setVolume(::Sound sound, float volume);
                 /**
                 * @brief Set pitch for a sound (1.0 is base level)
                 * 
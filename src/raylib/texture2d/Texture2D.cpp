@@ -10,6 +10,31 @@
  */
 
 #include "Texture2D.hpp"
+#include "../../profiling/Counters.hpp"
+#include "../../profiling/Resources.hpp"
+
+namespace
+{
+    /**
+     * @brief Account a loaded texture
+     *
+     * @param texture The texture, nothing is recorded when the load failed
+     * @param site Code that loaded it
+     * @return ::Texture2D The texture
+     */
+    ::Texture2D track(::Texture2D texture, const std::source_location &site)
+    {
+        std::size_t bytes = ::GetPixelDataSize(texture.width, texture.height, texture.format);
+
+        if (texture.id == 0)
+            return (texture);
+        // A full mipmap chain adds a third
+        if (texture.mipmaps > 1)
+            bytes += bytes / 3;
+        indie::profiling::Resources::track(indie::profiling::TEXTURE, texture.id, bytes, site);
+        return (texture);
+    }
+} // namespace
 
 indie::raylib::Texture2D::Texture2D(unsigned int id, int width, int height, int mipmaps, int format)
 {
@@ -170,23 +195,36 @@ void indie::raylib::Texture2D::drawPoly(
     ::DrawTexturePoly(texture, center, points, texcoords, pointsCount, tint);
 }
 
-::Texture2D indie::raylib::Texture2D::load(const char *fileName)
+::Texture2D indie::raylib::Texture2D::load(const char *fileName, const std::source_location &site)
 {
-    return ::LoadTexture(fileName);
+    COUNTER_INC(TEXTURE_LOADS);
+    return track(::LoadTexture(fileName), site);
 }
 
-::Texture2D indie::raylib::Texture2D::loadFromImage(::Image image)
+::Texture2D indie::raylib::Texture2D::loadFromImage(::Image image, const std::source_location &site)
 {
-    return ::LoadTextureFromImage(image);
+    return track(::LoadTextureFromImage(image), site);
+}
+
+::Image indie::raylib::Texture2D::loadImage(const std::string &fileName)
+{
+    return ::LoadImage(fileName.c_str());
+}
+
+void indie::raylib::Texture2D::unloadImage(::Image image)
+{
+    ::UnloadImage(image);
 }
 
 void indie::raylib::Texture2D::unload()
 {
+    indie::profiling::Resources::untrack(indie::profiling::TEXTURE, _texture.id);
     ::UnloadTexture(_texture);
 }
 
 void indie::raylib::Texture2D::unload(::Texture2D texture)
 {
+    indie::profiling::Resources::untrack(indie::profiling::TEXTURE, texture.id);
     ::UnloadTexture(texture);
 }
 
@@ -12,6 +12,8 @@
 #ifndef TEXTURE2D_HPP_
 #define TEXTURE2D_HPP_
 
+#include <source_location>
+#include <string>
 #include "../Raylib.hpp"
 
 namespace indie
@@ -282,19 +284,38 @@ namespace indie
              * @brief Load texture from file into GPU memory (VRAM)
              * 
              * @param fileName Filepath to the texture file
+             * @param site Code loading it, for the resource accounting
              * 
              * @return Texture2D The texture2D object
              */
-            static ::Texture2D load(const char *fileName);
+            static ::Texture2D load(
+                const char *fileName, const std::source_location &site = std::source_location::current());
 
             /**
              * @brief Load texture from image data
              * 
              * @param image Image object
+             * @param site Code loading it, for the resource accounting
              * 
              * @return Texture2D The texture2D object
              */
-            static ::Texture2D loadFromImage(::Image image);
+            static ::Texture2D loadFromImage(
+                ::Image image, const std::source_location &site = std::source_location::current());
+
+            /**
+             * @brief Decode an image file into CPU memory, without any GL call
+             * 
+             * @param fileName Filepath to the image file
+             * 
+             * @return Image Decoded pixels, without data when the file could not be decoded
+             */
+            static ::Image loadImage(const std::string &fileName);
+            /**
+             * @brief Unload decoded pixels from CPU memory
+             * 
+             * @param image Decoded pixels
+             */
+            static void unloadImage(::Image image);
 
             /**
              * @brief Unload texture from GPU memory (VRAM)
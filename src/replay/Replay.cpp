@@ -0,0 +1,349 @@
+/**
+ * @file Replay.cpp
+ * @brief Match recording as a seed plus a compact per-tick input log
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "Replay.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+namespace
+{
+    constexpr char REPLAY_MAGIC[4] = {'I', 'R', 'P', 'L'};
+    constexpr char REPLAY_INDEX_MAGIC[4] = {'I', 'K', 'F', 'X'};
+    constexpr std::uint8_t REPLAY_VERSION = 5;
+    /// Oldest version with a flag byte per seat, the previous ones packed four seats in a mask
+    constexpr std::uint8_t REPLAY_SEATS_VERSION = 5;
+    /// Oldest version whose keyframes have the current world layout (flame field since 4)
+    constexpr std::uint8_t REPLAY_KEYFRAME_VERSION = 4;
+    /// Fixed part of the header, the seat flags follow it since version 5
+    constexpr std::size_t REPLAY_HEADER_SIZE = 10;
+    constexpr std::size_t REPLAY_FOOTER_SIZE = 12;
+    constexpr std::uint8_t REPLAY_END = 0xFF;
+    constexpr std::uint8_t REPLAY_KEYFRAME = 0xFE;
+    constexpr std::size_t REPLAY_FLUSH_SIZE = 4096;
+
+    void putU32(std::vector<std::uint8_t> &buffer, std::uint32_t value)
+    {
+        for (int i = 0; i < 4; i++)
+            buffer.push_back(static_cast<std::uint8_t>(value >> (i * 8)));
+    }
+
+    std::uint32_t getU32(const std::uint8_t *bytes)
+    {
+        std::uint32_t value = 0;
+
+        for (int i = 0; i < 4; i++)
+            value |= static_cast<std::uint32_t>(bytes[i]) << (i * 8);
+        return (value);
+    }
+} // namespace
+
+indie::replay::Replay::Replay()
+    : _written(0), _end(0), _cursor(0), _state(), _lastTick(0), _endTick(0), _nextTick(0), _nextController(0), _nextPacked(0), _hasNext(false),
+      _seed(0), _seats(), _recording(false), _playing(false)
+{
+}
+
+indie::replay::Replay::~Replay()
+{
+    stop();
+}
+
+std::uint8_t indie::replay::Replay::pack(const indie::Event::ControllerEvent &controller)
+{
+    std::uint8_t code = (controller.code >= indie::Event::CONTROLLER_NONE && controller.code <= indie::Event::R3_BUTTON)
+        ? static_cast<std::uint8_t>(controller.code)
+        : indie::Event::CONTROLLER_NONE;
+    std::uint8_t joystick = (controller.leftJoystick >= indie::Event::JOYSTICK_NONE
+                                && controller.leftJoystick <= indie::Event::LEFT)
+        ? static_cast<std::uint8_t>(controller.leftJoystick)
+        : indie::Event::JOYSTICK_NONE;
+
+    return (static_cast<std::uint8_t>(code | (joystick << 5)));
+}
+
+bool indie::replay::Replay::startRecording(
+    const std::string &path, std::uint32_t seed, const std::vector<std::uint8_t> &seats)
+{
+    stop();
+    this->_file.open(path, std::ios::binary | std::ios::out | std::ios::trunc);
+    if (!this->_file.is_open())
+        return (false);
+    this->_seed = seed;
+    this->_seats.assign(
+        seats.begin(), seats.begin() + static_cast<std::ptrdiff_t>(std::min<std::size_t>(seats.size(), 0xFF)));
+    this->_lastTick = 0;
+    this->_endTick = 0;
+    std::memset(this->_state, 0, sizeof(this->_state));
+    this->_buffer.assign(REPLAY_MAGIC, REPLAY_MAGIC + sizeof(REPLAY_MAGIC));
+    this->_buffer.push_back(REPLAY_VERSION);
+    this->_buffer.push_back(static_cast<std::uint8_t>(this->_seats.size()));
+    putU32(this->_buffer, seed);
+    this->_buffer.insert(this->_buffer.end(), this->_seats.begin(), this->_seats.end());
+    this->_keyframes.clear();
+    this->_written = 0;
+    this->_recording = true;
+    return (true);
+}
+
+void indie::replay::Replay::write(std::uint32_t tick, std::uint8_t controller, std::uint8_t packed)
+{
+    std::uint32_t delta = tick - this->_lastTick;
+
+    while (delta >= 0x80) {
+        this->_buffer.push_back(static_cast<std::uint8_t>(delta | 0x80));
+        delta >>= 7;
+    }
+    this->_buffer.push_back(static_cast<std::uint8_t>(delta));
+    this->_buffer.push_back(controller);
+    this->_buffer.push_back(packed);
+    this->_lastTick = tick;
+    if (this->_buffer.size() >= REPLAY_FLUSH_SIZE)
+        flush();
+}
+
+void indie::replay::Replay::flush()
+{
+    if (this->_buffer.empty())
+        return;
+    this->_file.write(
+        reinterpret_cast<const char *>(this->_buffer.data()), static_cast<std::streamsize>(this->_buffer.size()));
+    this->_file.flush();
+    this->_written += this->_buffer.size();
+    this->_buffer.clear();
+}
+
+void indie::replay::Replay::record(std::uint32_t tick, const indie::Event &event)
+{
+    if (!this->_recording)
+        return;
+    this->_endTick = tick;
+    for (std::size_t i = 0; i < CONTROLLERS; i++) {
+        std::uint8_t packed = pack(event.controller[i]);
+        if (packed == this->_state[i])
+            continue;
+        this->_state[i] = packed;
+        write(tick, static_cast<std::uint8_t>(i), packed);
+    }
+}
+
+bool indie::replay::Replay::wantsKeyframe(std::uint32_t tick) const
+{
+    return (this->_recording && tick % KEYFRAME_INTERVAL == 0
+        && (this->_keyframes.empty() || this->_keyframes.back().tick != tick));
+}
+
+void indie::replay::Replay::writeKeyframe(std::uint32_t tick, const std::vector<std::uint8_t> &world)
+{
+    std::uint32_t delta = tick - this->_lastTick;
+
+    if (!this->_recording)
+        return;
+    this->_keyframes.push_back({tick, static_cast<std::uint32_t>(this->_written + this->_buffer.size())});
+    while (delta >= 0x80) {
+        this->_buffer.push_back(static_cast<std::uint8_t>(delta | 0x80));
+        delta >>= 7;
+    }
+    this->_buffer.push_back(static_cast<std::uint8_t>(delta));
+    this->_buffer.push_back(REPLAY_KEYFRAME);
+    putU32(this->_buffer, static_cast<std::uint32_t>(world.size()));
+    this->_buffer.insert(this->_buffer.end(), this->_state, this->_state + CONTROLLERS);
+    this->_buffer.insert(this->_buffer.end(), world.begin(), world.end());
+    this->_lastTick = tick;
+    if (this->_buffer.size() >= REPLAY_FLUSH_SIZE)
+        flush();
+}
+
+void indie::replay::Replay::stop()
+{
+    if (this->_recording) {
+        write(this->_endTick, REPLAY_END, 0);
+        std::uint32_t indexOffset = static_cast<std::uint32_t>(this->_written + this->_buffer.size());
+        for (auto &keyframe : this->_keyframes) {
+            putU32(this->_buffer, keyframe.tick);
+            putU32(this->_buffer, keyframe.offset);
+        }
+        putU32(this->_buffer, static_cast<std::uint32_t>(this->_keyframes.size()));
+        putU32(this->_buffer, indexOffset);
+        this->_buffer.insert(this->_buffer.end(), REPLAY_INDEX_MAGIC, REPLAY_INDEX_MAGIC + sizeof(REPLAY_INDEX_MAGIC));
+        flush();
+        this->_file.close();
+        this->_recording = false;
+    }
+    this->_playing = false;
+}
+
+void indie::replay::Replay::readIndex()
+{
+    this->_keyframes.clear();
+    this->_end = this->_buffer.size();
+    if (this->_buffer.size() < REPLAY_HEADER_SIZE + REPLAY_FOOTER_SIZE)
+        return;
+    const std::uint8_t *footer = this->_buffer.data() + this->_buffer.size() - REPLAY_FOOTER_SIZE;
+    if (std::memcmp(footer + 8, REPLAY_INDEX_MAGIC, sizeof(REPLAY_INDEX_MAGIC)) != 0)
+        return;
+    std::uint32_t count = getU32(footer);
+    std::uint32_t indexOffset = getU32(footer + 4);
+    if (indexOffset < REPLAY_HEADER_SIZE
+        || static_cast<std::size_t>(indexOffset) + static_cast<std::size_t>(count) * 8
+            != this->_buffer.size() - REPLAY_FOOTER_SIZE)
+        return;
+    for (std::uint32_t i = 0; i < count; i++) {
+        const std::uint8_t *entry = this->_buffer.data() + indexOffset + i * 8;
+        this->_keyframes.push_back({getU32(entry), getU32(entry + 4)});
+    }
+    this->_end = indexOffset;
+    // Older keyframes cannot be restored, the replay still plays from the start
+    if (this->_buffer[4] < REPLAY_KEYFRAME_VERSION)
+        this->_keyframes.clear();
+}
+
+bool indie::replay::Replay::seek(std::uint32_t tick, std::vector<std::uint8_t> &world, std::uint32_t &keyframeTick)
+{
+    auto it = std::upper_bound(this->_keyframes.begin(), this->_keyframes.end(), tick,
+        [](std::uint32_t value, const KeyframeEntry &entry) { return (value < entry.tick); });
+
+    if (this->_recording || this->_buffer.empty() || it == this->_keyframes.begin())
+        return (false);
+    --it;
+    std::size_t cursor = it->offset;
+    while (cursor < this->_end && (this->_buffer[cursor] & 0x80))
+        cursor++;
+    cursor++;
+    if (cursor + 5 + CONTROLLERS > this->_end || this->_buffer[cursor] != REPLAY_KEYFRAME)
+        return (false);
+    std::uint32_t size = getU32(this->_buffer.data() + cursor + 1);
+    cursor += 5;
+    if (cursor + CONTROLLERS + size > this->_end)
+        return (false);
+    std::memcpy(this->_state, this->_buffer.data() + cursor, CONTROLLERS);
+    cursor += CONTROLLERS;
+    world.assign(this->_buffer.begin() + static_cast<std::ptrdiff_t>(cursor),
+        this->_buffer.begin() + static_cast<std::ptrdiff_t>(cursor + size));
+    this->_cursor = cursor + size;
+    this->_lastTick = it->tick;
+    this->_endTick = it->tick;
+    keyframeTick = it->tick;
+    this->_hasNext = readNext();
+    this->_playing = true;
+    return (true);
+}
+
+bool indie::replay::Replay::load(const std::string &path)
+{
+    std::ifstream file(path, std::ios::binary);
+
+    stop();
+    if (!file.is_open())
+        return (false);
+    this->_buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    if (this->_buffer.size() < REPLAY_HEADER_SIZE
+        || std::memcmp(this->_buffer.data(), REPLAY_MAGIC, sizeof(REPLAY_MAGIC)) != 0
+        || this->_buffer[4] == 0 || this->_buffer[4] > REPLAY_VERSION) {
+        this->_buffer.clear();
+        return (false);
+    }
+    this->_seed = getU32(this->_buffer.data() + 6);
+    std::size_t header = REPLAY_HEADER_SIZE;
+    if (this->_buffer[4] >= REPLAY_SEATS_VERSION) {
+        header += this->_buffer[5];
+        if (this->_buffer.size() < header) {
+            this->_buffer.clear();
+            return (false);
+        }
+        this->_seats.assign(this->_buffer.begin() + REPLAY_HEADER_SIZE,
+            this->_buffer.begin() + static_cast<std::ptrdiff_t>(header));
+    } else {
+        // Four seats, the playing ones in the low nibble and the bots in the high one
+        this->_seats.assign(4, 0);
+        for (std::size_t seat = 0; seat < 4; seat++)
+            this->_seats[seat] = static_cast<std::uint8_t>(((this->_buffer[5] >> seat) & 1) * SEAT_PLAYING
+                | ((this->_buffer[5] >> (seat + 4)) & 1) * SEAT_BOT);
+    }
+    readIndex();
+    this->_cursor = header;
+    this->_lastTick = 0;
+    this->_endTick = 0;
+    std::memset(this->_state, 0, sizeof(this->_state));
+    this->_hasNext = readNext();
+    this->_playing = true;
+    return (true);
+}
+
+bool indie::replay::Replay::readNext()
+{
+    while (this->_cursor < this->_end) {
+        std::uint32_t delta = 0;
+        int shift = 0;
+
+        while (this->_cursor < this->_end && shift < 32) {
+            std::uint8_t byte = this->_buffer[this->_cursor++];
+            delta |= static_cast<std::uint32_t>(byte & 0x7F) << shift;
+            shift += 7;
+            if ((byte & 0x80) == 0)
+                break;
+        }
+        if (this->_cursor + 2 > this->_end)
+            return (false);
+        this->_nextController = this->_buffer[this->_cursor++];
+        this->_lastTick += delta;
+        this->_endTick = this->_lastTick;
+        if (this->_nextController == REPLAY_KEYFRAME) {
+            if (this->_cursor + 4 > this->_end)
+                return (false);
+            this->_cursor += 4 + CONTROLLERS + getU32(this->_buffer.data() + this->_cursor);
+            continue;
+        }
+        this->_nextPacked = this->_buffer[this->_cursor++];
+        this->_nextTick = this->_lastTick;
+        return (this->_nextController != REPLAY_END);
+    }
+    return (false);
+}
+
+void indie::replay::Replay::apply(std::uint32_t tick, indie::Event &event)
+{
+    if (!this->_playing)
+        return;
+    if (!this->_hasNext && tick > this->_endTick) {
+        stop();
+        return;
+    }
+    while (this->_hasNext && this->_nextTick <= tick) {
+        if (this->_nextController < CONTROLLERS)
+            this->_state[this->_nextController] = this->_nextPacked;
+        this->_hasNext = readNext();
+    }
+    for (std::size_t i = 0; i < CONTROLLERS; i++) {
+        event.controller[i].code = this->_state[i] & 0x1F;
+        event.controller[i].leftJoystick = static_cast<indie::Event::JoystickDirection>(this->_state[i] >> 5);
+        event.controller[i].rightJoystick = indie::Event::JOYSTICK_NONE;
+    }
+}
+
+bool indie::replay::Replay::isRecording() const
+{
+    return (this->_recording);
+}
+
+bool indie::replay::Replay::isPlaying() const
+{
+    return (this->_playing);
+}
+
+std::uint32_t indie::replay::Replay::getSeed() const
+{
+    return (this->_seed);
+}
+
+const std::vector<std::uint8_t> &indie::replay::Replay::getSeats() const
+{
+    return (this->_seats);
+}
@@ -0,0 +1,285 @@
+/**
+ * @file Replay.hpp
+ * @brief Match recording as a seed plus a compact per-tick input log
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef REPLAY_HPP_
+#define REPLAY_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "events.hpp"
+
+/// @brief Replay of the last recorded match
+#define REPLAY_PATH "LastMatch.replay"
+
+namespace indie
+{
+    namespace replay
+    {
+        /**
+         * @brief Records or plays back the controller inputs of a match
+         *
+         * A replay is a header (magic, version, seat count, map seed, one flag byte per seat) followed by one record each time the state of a
+         * controller changes: [varint tick delta][controller][code (5 bits) | left joystick (3 bits)]. Holding a
+         * direction therefore costs nothing until it is released, which keeps a minute of play in a few KB.
+         *
+         * Every KEYFRAME_INTERVAL ticks a keyframe record ([varint tick delta][0xFE][u32 size][controller states]
+         * [world]) is inserted, and the file ends with an index of the keyframes followed by a fixed footer, so a
+         * viewer can restore the closest keyframe and only simulate the remaining ticks.
+         *
+         */
+        class Replay {
+          public:
+            /**
+             * @brief Maximum number of recorded controllers
+             *
+             */
+            static constexpr std::size_t CONTROLLERS = EVENT_CONTROLLERS;
+            /**
+             * @brief Ticks between two keyframes
+             *
+             */
+            static constexpr std::uint32_t KEYFRAME_INTERVAL = 300;
+            /**
+             * @brief Seat flag of a player in the match
+             *
+             */
+            static constexpr std::uint8_t SEAT_PLAYING = 1;
+            /**
+             * @brief Seat flag of a player driven by a bot
+             *
+             */
+            static constexpr std::uint8_t SEAT_BOT = 2;
+            /**
+             * @brief Construct a new idle Replay object
+             *
+             */
+            Replay();
+            /**
+             * @brief Destroy the Replay object, finishing the recording
+             *
+             */
+            ~Replay();
+            /**
+             * @brief Start recording a match
+             *
+             * @param path Path of the replay file
+             * @param seed Seed used to generate the map
+             * @param seats SEAT_PLAYING / SEAT_BOT flags of each seat, 255 seats at most
+             * @return true If the file is opened
+             */
+            bool startRecording(const std::string &path, std::uint32_t seed, const std::vector<std::uint8_t> &seats);
+            /**
+             * @brief Record the controllers state of a tick
+             *
+             * @param tick Simulation tick the event is applied to
+             * @param event Event read for this tick
+             */
+            void record(std::uint32_t tick, const indie::Event &event);
+            /**
+             * @brief Does the recording need a keyframe at this tick?
+             *
+             * @param tick Simulation tick about to be simulated
+             * @return true If writeKeyframe should be called before recording the tick
+             */
+            bool wantsKeyframe(std::uint32_t tick) const;
+            /**
+             * @brief Record a keyframe of the world
+             *
+             * @param tick Simulation tick of the keyframe
+             * @param world Serialized world
+             */
+            void writeKeyframe(std::uint32_t tick, const std::vector<std::uint8_t> &world);
+            /**
+             * @brief Move the playback to the last keyframe at or before a tick
+             *
+             * @param tick Wanted tick
+             * @param world Filled with the serialized world of the keyframe
+             * @param keyframeTick Filled with the tick of the keyframe
+             * @return true If a keyframe has been found
+             */
+            bool seek(std::uint32_t tick, std::vector<std::uint8_t> &world, std::uint32_t &keyframeTick);
+            /**
+             * @brief Stop recording or playing back
+             *
+             */
+            void stop();
+            /**
+             * @brief Load a replay file for playback
+             *
+             * @param path Path of the replay file
+             * @return true If the replay is valid
+             */
+            bool load(const std::string &path);
+            /**
+             * @brief Override the controllers state with the recorded one
+             *
+             * @param tick Simulation tick the event is applied to
+             * @param event Event to overwrite
+             */
+            void apply(std::uint32_t tick, indie::Event &event);
+            /**
+             * @brief Is a match being recorded?
+             *
+             * @return true If recording
+             */
+            bool isRecording() const;
+            /**
+             * @brief Is a replay being played back?
+             *
+             * @return true If playing back
+             */
+            bool isPlaying() const;
+            /**
+             * @brief Get the map seed of the replay
+             *
+             * @return std::uint32_t The seed
+             */
+            std::uint32_t getSeed() const;
+            /**
+             * @brief Get the seats of the replay
+             *
+             * @return const std::vector<std::uint8_t>& SEAT_PLAYING / SEAT_BOT flags of each seat
+             */
+            const std::vector<std::uint8_t> &getSeats() const;
+
+          private:
+            /**
+             * @brief Pack a controller state in a byte
+             *
+             * @param controller The controller state
+             * @return std::uint8_t Packed state
+             */
+            static std::uint8_t pack(const indie::Event::ControllerEvent &controller);
+            /**
+             * @brief Append a record to the output buffer
+             *
+             * @param tick Tick of the record
+             * @param controller Controller index, 0xFF for the end marker
+             * @param packed Packed controller state
+             */
+            void write(std::uint32_t tick, std::uint8_t controller, std::uint8_t packed);
+            /**
+             * @brief Write the output buffer to the file
+             *
+             */
+            void flush();
+            /**
+             * @brief Decode the next input record of the playback buffer, skipping keyframes
+             *
+             * @return true If a record has been decoded
+             */
+            bool readNext();
+            /**
+             * @brief Read the keyframe index from the footer of the playback buffer
+             *
+             */
+            void readIndex();
+            /**
+             * @brief Keyframe index entry
+             *
+             */
+            struct KeyframeEntry {
+                std::uint32_t tick;
+                std::uint32_t offset;
+            };
+            /**
+             * @brief Keyframes of the replay, sorted by tick
+             *
+             */
+            std::vector<KeyframeEntry> _keyframes;
+            /**
+             * @brief Bytes already written to the file
+             *
+             */
+            std::size_t _written;
+            /**
+             * @brief End of the record stream in the playback buffer
+             *
+             */
+            std::size_t _end;
+            /**
+             * @brief Replay file being written
+             *
+             */
+            std::ofstream _file;
+            /**
+             * @brief Recorded bytes not yet written, or the whole replay in playback
+             *
+             */
+            std::vector<std::uint8_t> _buffer;
+            /**
+             * @brief Read position in the playback buffer
+             *
+             */
+            std::size_t _cursor;
+            /**
+             * @brief Last recorded or applied state of each controller
+             *
+             */
+            std::uint8_t _state[CONTROLLERS];
+            /**
+             * @brief Tick of the last record
+             *
+             */
+            std::uint32_t _lastTick;
+            /**
+             * @brief Last tick of the match
+             *
+             */
+            std::uint32_t _endTick;
+            /**
+             * @brief Tick of the next decoded record (playback)
+             *
+             */
+            std::uint32_t _nextTick;
+            /**
+             * @brief Controller of the next decoded record
+             *
+             */
+            std::uint8_t _nextController;
+            /**
+             * @brief Packed state of the next decoded record
+             *
+             */
+            std::uint8_t _nextPacked;
+            /**
+             * @brief Is there a decoded record left to apply?
+             *
+             */
+            bool _hasNext;
+            /**
+             * @brief Map seed
+             *
+             */
+            std::uint32_t _seed;
+            /**
+             * @brief Flags of each seat
+             *
+             */
+            std::vector<std::uint8_t> _seats;
+            /**
+             * @brief Is recording
+             *
+             */
+            bool _recording;
+            /**
+             * @brief Is playing back
+             *
+             */
+            bool _playing;
+        };
+    } // namespace replay
+} // namespace indie
+
+#endif /* !REPLAY_HPP_ */
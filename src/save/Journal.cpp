@@ -0,0 +1,109 @@
+/**
+ * @file Journal.cpp
+ * @brief Write-ahead journal of per-tick world deltas used by the autosave
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "Journal.hpp"
+
+static_assert(sizeof(indie::save::Journal::Record) == 24, "Journal records must stay 24 bytes");
+
+indie::save::Journal::Journal() : _tick(0)
+{
+}
+
+indie::save::Journal::~Journal()
+{
+    close();
+}
+
+bool indie::save::Journal::open(const std::string &path)
+{
+    close();
+    this->_path = path;
+    this->_file.open(path, std::ios::binary | std::ios::out | std::ios::trunc);
+    this->_pending.reserve(64);
+    return (this->_file.is_open());
+}
+
+void indie::save::Journal::close()
+{
+    if (!this->_file.is_open())
+        return;
+    commit();
+    this->_file.close();
+}
+
+bool indie::save::Journal::isOpen() const
+{
+    return (this->_file.is_open());
+}
+
+void indie::save::Journal::beginTick(std::uint32_t tick)
+{
+    this->_tick = tick;
+}
+
+void indie::save::Journal::push(const Record &record)
+{
+    if (this->_file.is_open())
+        this->_pending.push_back(record);
+}
+
+void indie::save::Journal::tileChanged(int entityType, float x, float y)
+{
+    push({this->_tick, TILE_CHANGED, static_cast<std::uint8_t>(entityType), 0, x, y, {0, 0, 0, 0}});
+}
+
+void indie::save::Journal::entityDestroyed(int entityType, float x, float y)
+{
+    push({this->_tick, ENTITY_DESTROYED, static_cast<std::uint8_t>(entityType), 0, x, y, {0, 0, 0, 0}});
+}
+
+void indie::save::Journal::playerStats(int player, std::uint16_t flags, float x, float y, const std::int16_t stats[4])
+{
+    push({this->_tick, PLAYER_STATS, static_cast<std::uint8_t>(player), flags, x, y,
+        {stats[0], stats[1], stats[2], stats[3]}});
+}
+
+void indie::save::Journal::bombPlaced(int player, float x, float y, float range)
+{
+    push({this->_tick, BOMB_PLACED, static_cast<std::uint8_t>(player), 0, x, y,
+        {static_cast<std::int16_t>(range), 0, 0, 0}});
+}
+
+void indie::save::Journal::commit()
+{
+    if (this->_pending.empty() || !this->_file.is_open())
+        return;
+    this->_file.write(reinterpret_cast<const char *>(this->_pending.data()),
+        static_cast<std::streamsize>(this->_pending.size() * sizeof(Record)));
+    this->_file.flush();
+    this->_pending.clear();
+}
+
+void indie::save::Journal::truncate()
+{
+    if (!this->_file.is_open())
+        return;
+    this->_pending.clear();
+    this->_file.close();
+    this->_file.open(this->_path, std::ios::binary | std::ios::out | std::ios::trunc);
+}
+
+std::vector<indie::save::Journal::Record> indie::save::Journal::read(const std::string &path)
+{
+    std::vector<Record> records;
+    std::ifstream file(path, std::ios::binary);
+    Record record;
+
+    if (!file.is_open())
+        return (records);
+    while (file.read(reinterpret_cast<char *>(&record), sizeof(Record)))
+        records.push_back(record);
+    return (records);
+}
@@ -0,0 +1,180 @@
+/**
+ * @file Journal.hpp
+ * @brief Write-ahead journal of per-tick world deltas used by the autosave
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef JOURNAL_HPP_
+#define JOURNAL_HPP_
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace indie
+{
+    namespace save
+    {
+        /**
+         * @brief Append-only journal of world deltas
+         *
+         * Records emitted during a tick are buffered in memory and handed to the OS with a single write when the
+         * tick is committed, so journaling costs one small write per tick instead of a full text dump. A full
+         * checkpoint is written separately; the journal only holds what happened since that checkpoint.
+         *
+         */
+        class Journal {
+          public:
+            /**
+             * @brief Kind of delta stored in a record
+             *
+             */
+            enum RecordType : std::uint8_t { TILE_CHANGED, ENTITY_DESTROYED, PLAYER_STATS, BOMB_PLACED };
+            /**
+             * @brief Flags of a PLAYER_STATS record
+             *
+             */
+            enum PlayerFlags : std::uint16_t { PLAYER_ALIVE = 1 << 0, PLAYER_PLAYING = 1 << 1, PLAYER_BOT = 1 << 2 };
+            /**
+             * @brief Fixed size journal record
+             *
+             * subject is the entity type for TILE_CHANGED / ENTITY_DESTROYED and the player index otherwise.
+             * values holds radius, stock, max stock and speed for PLAYER_STATS and the range for BOMB_PLACED.
+             *
+             */
+            struct Record {
+                std::uint32_t tick;
+                std::uint8_t type;
+                std::uint8_t subject;
+                std::uint16_t flags;
+                float x;
+                float y;
+                std::int16_t values[4];
+            };
+            /**
+             * @brief Construct a new closed Journal object
+             *
+             */
+            Journal();
+            /**
+             * @brief Destroy the Journal object, committing pending records
+             *
+             */
+            ~Journal();
+            /**
+             * @brief Open (and truncate) the journal file
+             *
+             * @param path Path of the journal file
+             * @return true If the file is opened
+             * @return false Otherwise
+             */
+            bool open(const std::string &path);
+            /**
+             * @brief Commit pending records and close the file
+             *
+             */
+            void close();
+            /**
+             * @brief Is the journal recording?
+             *
+             * @return true If a file is opened
+             */
+            bool isOpen() const;
+            /**
+             * @brief Start a new tick, following records are stamped with it
+             *
+             * @param tick Simulation tick
+             */
+            void beginTick(std::uint32_t tick);
+            /**
+             * @brief A map tile lost its content (box destroyed)
+             *
+             * @param entityType Type of the entity that was on the tile
+             * @param x X position of the tile
+             * @param y Y position of the tile
+             */
+            void tileChanged(int entityType, float x, float y);
+            /**
+             * @brief A non tile entity (bomb, bonus) has been removed
+             *
+             * @param entityType Type of the removed entity
+             * @param x X position of the entity
+             * @param y Y position of the entity
+             */
+            void entityDestroyed(int entityType, float x, float y);
+            /**
+             * @brief Player stats or position changed
+             *
+             * @param player Player index
+             * @param flags Combination of PlayerFlags
+             * @param x X position of the player entity
+             * @param y Y position of the player entity
+             * @param stats Radius, bomb stock, max bomb stock and speed
+             */
+            void playerStats(int player, std::uint16_t flags, float x, float y, const std::int16_t stats[4]);
+            /**
+             * @brief A bomb has been placed
+             *
+             * @param player Owner of the bomb
+             * @param x X position of the bomb
+             * @param y Y position of the bomb
+             * @param range Explosion range of the bomb
+             */
+            void bombPlaced(int player, float x, float y, float range);
+            /**
+             * @brief Write the records of the current tick with a single write
+             *
+             */
+            void commit();
+            /**
+             * @brief Drop every record, called once a checkpoint covers them
+             *
+             */
+            void truncate();
+            /**
+             * @brief Read every complete record of a journal file
+             *
+             * A torn trailing record (crash during a write) is ignored.
+             *
+             * @param path Path of the journal file
+             * @return std::vector<Record> Records in write order
+             */
+            static std::vector<Record> read(const std::string &path);
+
+          private:
+            /**
+             * @brief Queue a record for the current tick
+             *
+             * @param record The record
+             */
+            void push(const Record &record);
+            /**
+             * @brief Journal file
+             *
+             */
+            std::ofstream _file;
+            /**
+             * @brief Path of the journal file
+             *
+             */
+            std::string _path;
+            /**
+             * @brief Records of the current tick
+             *
+             */
+            std::vector<Record> _pending;
+            /**
+             * @brief Current tick
+             *
+             */
+            std::uint32_t _tick;
+        };
+    } // namespace save
+} // namespace indie
+
+#endif /* !JOURNAL_HPP_ */
@@ -11,20 +11,35 @@
 
 #include "GameScreen.hpp"
 #include "../../player/Player.hpp"
+#include "../../profiling/Counters.hpp"
+#include "../../profiling/Trace.hpp"
 #include "../../raylib/Raylib.hpp"
+#include "../../replay/Replay.hpp"
+#include "../../tools/FrameArena.hpp"
 #include "../../tools/Tools.hpp"
 #include "../ecs/system/Sound/Sound.hpp"
 #include "Colors.hpp"
 #include "uiPlayerDisplay/UIPlayerDisplay.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <limits>
 #include <vector>
 
 indie::menu::GameScreen::GameScreen(std::vector<player::Player> *players,
     std::vector<std::unique_ptr<indie::ecs::entity::Entity>> *soundEntities,
     std::vector<std::unique_ptr<indie::ecs::system::ISystem>> *soundSystems)
-    : _camera({0.0, 60.0, 18.0}, {0.0, -1.5, 0.0}, {0.0, 1.0, 0.0}, 40.0, CAMERA_PERSPECTIVE), _player1_blue(false),
-      _player2_red(false), _player3_green(false), _player4_yellow(false), _is_game_finished(false),
-      _end_screen_display(true)
+    : _camera({0.0, 60.0, 18.0}, {0.0, -1.5, 0.0}, {0.0, 1.0, 0.0}, 40.0, CAMERA_PERSPECTIVE),
+      _is_game_finished(false), _end_screen_display(true), _tick(0), _checkpointInterval(0), _muted(false),
+      _inputLatency(nullptr), _frameStats(nullptr), _jobs(nullptr), _mixer(nullptr),
+      _inputSystem(std::make_unique<indie::ecs::system::InputSystem>(players)),
+      _explodeSystem(nullptr), _bots()
 {
     _players = players;
     _soundEntities = soundEntities;
@@ -37,8 +52,8 @@ void indie::menu::GameScreen::init()
     std::unique_ptr<indie::ecs::system::ISystem> draw3DSystem = std::make_unique<indie::ecs::system::Draw3DSystem>();
     std::unique_ptr<indie::ecs::system::ISystem> movementSystem =
         std::make_unique<indie::ecs::system::MovementSystem>();
-    std::unique_ptr<indie::ecs::system::ISystem> soundSystem = std::make_unique<indie::ecs::system::Sound>();
-    std::unique_ptr<indie::ecs::system::ISystem> collideSystem = std::make_unique<indie::ecs::system::Collide>();
+    std::unique_ptr<indie::ecs::system::Sound> soundSystem = std::make_unique<indie::ecs::system::Sound>();
+    std::unique_ptr<indie::ecs::system::Collide> collideSystem = std::make_unique<indie::ecs::system::Collide>();
     std::unique_ptr<indie::ecs::system::Explodable> explodeSystem = std::make_unique<indie::ecs::system::Explodable>();
     std::unique_ptr<indie::ecs::system::ObjectSystem> objectSystem =
         std::make_unique<indie::ecs::system::ObjectSystem>();
@@ -54,6 +69,10 @@ void indie::menu::GameScreen::init()
     _playerAssets[1] = std::string("./assets/red.png");
     _playerAssets[2] = std::string("./assets/green.png");
     _playerAssets[3] = std::string("./assets/yellow.png");
+    soundSystem->setMixer(this->_mixer);
+    collideSystem->setJournal(&this->_journal);
+    explodeSystem->setJournal(&this->_journal);
+    this->_explodeSystem = explodeSystem.get();
     this->addEntity(std::move(entityX));
     this->addSystem(std::move(draw2DSystem));
     this->addSystem(std::move(draw3DSystem));
@@ -64,29 +83,146 @@ void indie::menu::GameScreen::init()
     this->addSystem(std::move(objectSystem));
 }
 
+bool indie::menu::GameScreen::isRenderSystem(indie::ecs::system::SystemType type) const
+{
+    return (type == indie::ecs::system::SystemType::DRAWABLE2DSYSTEM
+        || type == indie::ecs::system::SystemType::DRAWABLE3DSYSTEM
+        || type == indie::ecs::system::SystemType::OBJECTSYSTEM);
+}
+
+const char *indie::menu::GameScreen::getSystemZone(indie::ecs::system::SystemType type)
+{
+    switch (type) {
+        case indie::ecs::system::DRAWABLE3DSYSTEM: return ("Draw3DSystem::update");
+        case indie::ecs::system::DRAWABLE2DSYSTEM: return ("Draw2DSystem::update");
+        case indie::ecs::system::MOVEMENTSYSTEM: return ("MovementSystem::update");
+        case indie::ecs::system::COLLIDESYSTEM: return ("Collide::update");
+        case indie::ecs::system::SOUNDSYSTEM: return ("Sound::update");
+        case indie::ecs::system::EXPLODABLESYSTEM: return ("Explodable::update");
+        case indie::ecs::system::OBJECTSYSTEM: return ("ObjectSystem::update");
+        case indie::ecs::system::INPUTSYSTEM: return ("InputSystem::update");
+        default: return ("ISystem::update");
+    }
+}
+
+void indie::menu::GameScreen::runSystem(indie::ecs::system::ISystem &system)
+{
+    indie::profiling::Zone zone(getSystemZone(system.getSystemType()));
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    system.update(this->_entities);
+    if (this->_frameStats != nullptr)
+        this->_frameStats->addSystem(system.getSystemType(), std::chrono::steady_clock::now() - start);
+}
+
 void indie::menu::GameScreen::draw()
 {
+    TRACE_ZONE("GameScreen::draw");
     indie::raylib::Camera3D camera = getCamera();
     indie::raylib::Window::beginDrawing();
     indie::raylib::Window::clearBackground(SKYBLUE);
 
     for (auto &system : this->_systems) {
+        if (!isRenderSystem(system->getSystemType()))
+            continue;
         if ((system->getSystemType() == indie::ecs::system::SystemType::DRAWABLE3DSYSTEM
                 || system->getSystemType() == indie::ecs::system::SystemType::OBJECTSYSTEM)
             && !_is_game_finished) {
             camera.beginMode();
-            system->update(this->_entities);
+            runSystem(*system);
             camera.endMode();
         } else {
-            system->update(this->_entities);
+            runSystem(*system);
         }
     }
+    if (!_is_game_finished) {
+        TRACE_ZONE("GameScreen::drawFlames");
+        drawFlames(camera);
+    }
     for (auto &uiDisplay : _infoPlayers)
         if (uiDisplay->getPlayer().getIsAlive() && !_is_game_finished)
             uiDisplay->draw();
+    if (this->_inputLatency != nullptr && this->_inputLatency->isVisible())
+        indie::raylib::Draw(10, 10, 20, BLACK).drawText(this->_inputLatency->toString());
+    if (this->_frameStats != nullptr) {
+        this->_frameStats->countEntities(this->_entities);
+        if (this->_frameStats->isVisible())
+            indie::raylib::Draw(10, 40, 20, BLACK).drawText(this->_frameStats->toString());
+    }
+    TRACE_ZONE("Window::endDrawing");
     indie::raylib::Window::endDrawing();
+}
+
+void indie::menu::GameScreen::drawFlames(indie::raylib::Camera3D &camera)
+{
+    const indie::board::FlameField &flames = this->_explodeSystem->getFlameField();
+
+    if (!flames.isActive())
+        return;
+    // Untextured cubes only, raylib keeps them all in the same render batch
+    camera.beginMode();
+    flames.getBurning().forEach([&flames](int tile) {
+        float x = indie::board::Board::getTileX(tile);
+        float y = indie::board::Board::getTileY(tile);
+        ::Color color = ORANGE;
+
+        color.a = static_cast<unsigned char>(80 + 175 * flames.getLifetime(tile) / FLAME_TICKS);
+        indie::raylib::Cube::draw({x, -0.5f, y}, {1.8f, 1.0f, 1.8f}, color);
+    });
+    indie::profiling::FrameStats::countDrawCalls(flames.getBurning().count());
+    camera.endMode();
+}
+
+void indie::menu::GameScreen::update()
+{
+    if (_is_game_finished && this->_journal.isOpen())
+        disableAutosave();
+    if (!_is_game_finished) {
+        TRACE_ZONE("GameScreen::update");
+        indie::tools::FrameVector<indie::ecs::system::ISystem *> systems;
+        // The inputs of the tick are applied already, the kernel only replays what the systems do
+        bool checkSim = this->_tick % SIM_CHECK_PERIOD_TICKS == 0;
+        indie::ai::SimState predicted = {};
+        if (checkSim) {
+            std::array<indie::ai::SimState::Action, SIM_MAX_PLAYERS> rest;
+            rest.fill({indie::Event::JOYSTICK_NONE, false});
+            predicted = getSimState();
+            predicted.step(rest.data());
+        }
+        for (auto &system : this->_systems)
+            if (!isRenderSystem(system->getSystemType()))
+                systems.push_back(system.get());
+        // Each system type has its own slot in the frame statistics, runSystem may run on several threads at once
+        this->_scheduler.run(
+            systems, this->_tick, this->_jobs, [this](indie::ecs::system::ISystem &system) { runSystem(system); });
+        // The removals are applied in the order of the systems, once none of them reads the entities anymore
+        for (auto system : systems)
+            system->flush(this->_entities);
+        updateEntities();
+        if (checkSim)
+            checkSimState(predicted);
+        if (this->_journal.isOpen()) {
+            journalPlayers();
+            this->_journal.commit();
+            if (std::chrono::steady_clock::now() - this->_lastCheckpoint >= this->_checkpointInterval)
+                writeCheckpoint();
+        }
+        this->_tick++;
+        this->_journal.beginTick(this->_tick);
+        // A seek runs muted, its ticks are counted but the snapshot waits for the playback to resume
+        indie::profiling::Counters::endTick(!this->_muted);
+    }
+    if (indie::ecs::system::Scheduler::isDue({HUD_PERIOD_TICKS, 2}, this->_tick))
+        for (auto &uiDisplay : _infoPlayers)
+            uiDisplay->update();
+    // The scratch of the systems is dead once the tick is over
+    indie::tools::FrameArena::local().reset();
+}
+
+void indie::menu::GameScreen::updateEntities()
+{
     size_t index = 0;
-    std::vector<size_t> entityToRemove;
+    indie::tools::FrameVector<size_t> entityToRemove;
     for (auto &entity : _entities) {
         if (entity->hasCompoType(indie::ecs::component::EXPLODABLE)) {
             auto explodeCompo =
@@ -97,31 +233,40 @@ void indie::menu::GameScreen::draw()
                 entityToRemove.push_back(index);
             }
         }
-        indie::ecs::entity::entityType type = entity->getEntityType();
-        if (type == indie::ecs::entity::entityType::PLAYER_1 || type == indie::ecs::entity::entityType::PLAYER_2
-            || type == indie::ecs::entity::entityType::PLAYER_3 || type == indie::ecs::entity::entityType::PLAYER_4) {
+        auto control =
+            entity->getComponent<indie::ecs::component::PlayerControl>(indie::ecs::component::PLAYERCONTROL);
+        if (entity->getEntityType() == indie::ecs::entity::PLAYER && control != nullptr
+            && control->getPlayer() < static_cast<int>(this->_players->size())) {
+            player::Player &player = this->_players->at(control->getPlayer());
             entity->getComponent<indie::ecs::component::Transform>(indie::ecs::component::TRANSFORM)->setSpeedX(0.0f);
             entity->getComponent<indie::ecs::component::Transform>(indie::ecs::component::TRANSFORM)->setSpeedY(0.0f);
             if (entity->hasCompoType(indie::ecs::component::INVENTORY)) {
                 auto inventory =
                     entity->getComponent<indie::ecs::component::Inventory>(indie::ecs::component::INVENTORY);
                 if (inventory->getFireUp() == true) {
-                    this->_players->at(type).setBombRadius(this->_players->at(type).getBombRadius() + 1);
+                    player.setBombRadius(player.getBombRadius() + 1);
                     inventory->setFireUp(false);
                 } else if (inventory->getSpeedUp() == true) {
-                    this->_players->at(type).setSpeed(this->_players->at(type).getSpeed() + 3);
+                    player.setSpeed(player.getSpeed() + 3);
                     inventory->setSpeedUp(false);
                 } else if (inventory->getBombUp() == true) {
-                    this->_players->at(type).setBombStock(this->_players->at(type).getBombStock() + 1);
-                    this->_players->at(type).setMaxBombStock(this->_players->at(type).getMaxBombStock() + 1);
+                    player.setBombStock(player.getBombStock() + 1);
+                    player.setMaxBombStock(player.getMaxBombStock() + 1);
                     inventory->setBombUp(false);
                 }
             }
             if (entity->hasCompoType(indie::ecs::component::ALIVE)) {
-                bool alive =
-                    entity->getComponent<indie::ecs::component::Alive>(indie::ecs::component::ALIVE)->getAlive();
+                auto aliveCompo = entity->getComponent<indie::ecs::component::Alive>(indie::ecs::component::ALIVE);
+                auto transformCompo =
+                    entity->getComponent<indie::ecs::component::Transform>(indie::ecs::component::TRANSFORM);
+                // Walking into the flames of a past explosion kills as well
+                if (aliveCompo->getAlive()
+                    && this->_explodeSystem->getFlameField().isBurning(
+                        indie::board::Board::getTile(transformCompo->getX(), transformCompo->getY())))
+                    aliveCompo->setAlive(false);
+                bool alive = aliveCompo->getAlive();
                 if (alive == false) {
-                    this->_players->at(type).setIsAlive(false);
+                    player.setIsAlive(false);
                 }
             }
         }
@@ -133,17 +278,14 @@ void indie::menu::GameScreen::draw()
     }
     size_t count = 0;
     for (auto &i : entityToRemove) {
+        auto transformCompo = this->_entities.at(i - count)->getComponent<indie::ecs::component::Transform>(
+            indie::ecs::component::TRANSFORM);
+        this->_journal.entityDestroyed(indie::ecs::entity::BOMB, transformCompo->getX(), transformCompo->getY());
         this->_entities.erase(this->_entities.begin() + i - count);
         count++;
     }
 }
 
-void indie::menu::GameScreen::update()
-{
-    for (auto &uiDisplay : _infoPlayers)
-        uiDisplay->update();
-}
-
 void indie::menu::GameScreen::addEntity(std::unique_ptr<indie::ecs::entity::Entity> entity)
 {
     this->_entities.push_back(std::move(entity));
@@ -171,13 +313,29 @@ indie::raylib::Camera3D indie::menu::GameScreen::getCamera() const
     return (this->_camera);
 }
 
-void indie::menu::GameScreen::getPlayersPlaying(
-    bool is_p1_playing, bool is_p2_playing, bool is_p3_playing, bool is_p4_playing)
+const indie::board::Board &indie::menu::GameScreen::getBoard() const
+{
+    return (this->_board);
+}
+
+indie::ai::SimState indie::menu::GameScreen::getSimState() const
 {
-    _player1_blue = is_p1_playing;
-    _player2_red = is_p2_playing;
-    _player3_green = is_p3_playing;
-    _player4_yellow = is_p4_playing;
+    return (indie::ai::SimState::capture(
+        this->_entities, *this->_players, *this->_explodeSystem, BOMB_FUSE_SECONDS * TICKS_PER_SECOND));
+}
+
+bool indie::menu::GameScreen::checkSimState(const indie::ai::SimState &predicted) const
+{
+    indie::ai::SimState actual = getSimState();
+    bool same = actual.bombCount == predicted.bombCount;
+
+    for (int tile = 0; same && tile < BOARD_TILES; tile++)
+        same = (actual.tiles[tile] & indie::ai::SimState::CONTENT)
+                == (predicted.tiles[tile] & indie::ai::SimState::CONTENT)
+            && (actual.flames[tile] > 0) == (predicted.flames[tile] > 0);
+    if (!same)
+        COUNTER_INC(SIM_MISMATCHES);
+    return (same);
 }
 
 void indie::menu::GameScreen::initEntity()
@@ -188,160 +346,149 @@ void indie::menu::GameScreen::initEntity()
     vec2f bottomLeftPos = vec2f({tools::Tools::getPercentage(3.f, true), tools::Tools::getPercentage(82.f, false)});
     vec2f bottomRightPos = vec2f({tools::Tools::getPercentage(84.f, true), tools::Tools::getPercentage(82.f, false)});
 
-    if (_player1_blue) {
-        this->_infoPlayers.push_back(std::make_unique<indie::screens::game::uiPlayerDisplay::UIPlayerDisplay>(
-            &_players->at(0), topLeftPos, uiSize));
-    }
-    if (_player2_red) {
-        this->_infoPlayers.push_back(std::make_unique<indie::screens::game::uiPlayerDisplay::UIPlayerDisplay>(
-            &_players->at(1), topRightPos, uiSize));
-    }
-    if (_player3_green) {
-        this->_infoPlayers.push_back(std::make_unique<indie::screens::game::uiPlayerDisplay::UIPlayerDisplay>(
-            &_players->at(2), bottomLeftPos, uiSize));
-    }
-    if (_player4_yellow) {
-        this->_infoPlayers.push_back(std::make_unique<indie::screens::game::uiPlayerDisplay::UIPlayerDisplay>(
-            &_players->at(3), bottomRightPos, uiSize));
+    vec2f corners[] = {topLeftPos, topRightPos, bottomLeftPos, bottomRightPos};
+
+    // The four corners of the screen hold the panels of the first four players
+    for (size_t i = 0; i < this->_players->size() && i < sizeof(corners) / sizeof(corners[0]); i++) {
+        if (this->_players->at(i).getIsPlaying())
+            this->_infoPlayers.push_back(std::make_unique<indie::screens::game::uiPlayerDisplay::UIPlayerDisplay>(
+                &_players->at(i), corners[i], uiSize));
     }
     for (auto &uiDisplay : this->_infoPlayers) {
         uiDisplay->create();
     }
 }
 
-void indie::menu::GameScreen::handleMultipleController(
-    indie::Event &event, int index, indie::ecs::entity::entityType type)
+void indie::menu::GameScreen::spawnBomb(int player, float x, float y, float range, int fuseTicks)
 {
-    indie::ecs::component::Transform *transformCompo = nullptr;
+    std::unique_ptr<indie::ecs::entity::Entity> entity =
+        std::make_unique<indie::ecs::entity::Entity>(indie::ecs::entity::entityType::BOMB);
+    indie::vec3f scaleVec({1.0f, 1.0f, 1.0f});
+    indie::vec3f rotationVec({1.0f, 0.0f, 0.0f});
 
-    if (event.controller[index].leftJoystick == indie::Event::DOWN) {
-        for (auto &entity : this->_entities) {
-            if (entity->getEntityType() == type) {
-                auto objectCompo = entity->getComponent<indie::ecs::component::Object>(indie::ecs::component::ANIMATED);
-                auto transform =
-                    entity->getComponent<indie::ecs::component::Transform>(indie::ecs::component::compoType::TRANSFORM);
-                float speed = static_cast<float>(this->_players->at(index).getSpeed());
-                transform->setSpeedY(speed / 50.0f);
-                transform->setSpeedX(0);
-                objectCompo->setOrientation(indie::ecs::component::Object::SOUTH);
-                objectCompo->setAnimationsCounter(objectCompo->getAnimationsCounter() + 5);
-                raylib::Model::updateModelAnimation(
-                    objectCompo->getModel(), objectCompo->getAnimations()[0], objectCompo->getAnimationsCounter());
-                if (objectCompo->getAnimationsCounter() >= objectCompo->getAnimations()[0].frameCount)
-                    objectCompo->setAnimationsCounter(0);
-            }
-        }
-    }
-    if (event.controller[index].leftJoystick == indie::Event::UP) {
-        for (auto &entity : this->_entities) {
-            if (entity->getEntityType() == type) {
-                auto objectCompo = entity->getComponent<indie::ecs::component::Object>(indie::ecs::component::ANIMATED);
-                auto transform =
-                    entity->getComponent<indie::ecs::component::Transform>(indie::ecs::component::compoType::TRANSFORM);
-                float speed = static_cast<float>(this->_players->at(index).getSpeed());
-                transform->setSpeedX(0);
-                transform->setSpeedY((speed / 50.0f) * -1.0f);
-                objectCompo->setOrientation(indie::ecs::component::Object::NORTH);
-                objectCompo->setAnimationsCounter(objectCompo->getAnimationsCounter() + 5);
-                raylib::Model::updateModelAnimation(
-                    objectCompo->getModel(), objectCompo->getAnimations()[0], objectCompo->getAnimationsCounter());
-                if (objectCompo->getAnimationsCounter() >= objectCompo->getAnimations()[0].frameCount)
-                    objectCompo->setAnimationsCounter(0);
-            }
-        }
-    }
-    if (event.controller[index].leftJoystick == indie::Event::LEFT) {
-        for (auto &entity : this->_entities) {
-            if (entity->getEntityType() == type) {
-                auto objectCompo = entity->getComponent<indie::ecs::component::Object>(indie::ecs::component::ANIMATED);
-                auto transform =
-                    entity->getComponent<indie::ecs::component::Transform>(indie::ecs::component::compoType::TRANSFORM);
-                float speed = static_cast<float>(this->_players->at(index).getSpeed());
-                transform->setSpeedX((speed / 50.0f) * -1.0f);
-                transform->setSpeedY(0);
-                objectCompo->setOrientation(indie::ecs::component::Object::WEST);
-                objectCompo->setAnimationsCounter(objectCompo->getAnimationsCounter() + 5);
-                raylib::Model::updateModelAnimation(
-                    objectCompo->getModel(), objectCompo->getAnimations()[0], objectCompo->getAnimationsCounter());
-                if (objectCompo->getAnimationsCounter() >= objectCompo->getAnimations()[0].frameCount)
-                    objectCompo->setAnimationsCounter(0);
-            }
-        }
-    }
-    if (event.controller[index].leftJoystick == indie::Event::RIGHT) {
-        for (auto &entity : this->_entities) {
-            if (entity->getEntityType() == type) {
-                auto objectCompo = entity->getComponent<indie::ecs::component::Object>(indie::ecs::component::ANIMATED);
-                auto transform =
-                    entity->getComponent<indie::ecs::component::Transform>(indie::ecs::component::compoType::TRANSFORM);
-                float speed = static_cast<float>(this->_players->at(index).getSpeed());
-                if (transform != nullptr) {
-                    transform->setSpeedX(speed / 50.0f);
-                    transform->setSpeedY(0);
-                }
-                objectCompo->setOrientation(indie::ecs::component::Object::EAST);
-                objectCompo->setAnimationsCounter(objectCompo->getAnimationsCounter() + 5);
-                raylib::Model::updateModelAnimation(
-                    objectCompo->getModel(), objectCompo->getAnimations()[0], objectCompo->getAnimationsCounter());
-                if (objectCompo->getAnimationsCounter() >= objectCompo->getAnimations()[0].frameCount)
-                    objectCompo->setAnimationsCounter(0);
-            }
+    entity->addComponent<indie::ecs::component::Object>(
+        "assets/objects/Bomb/Bomb.png", "assets/objects/Bomb/bomb.obj", scaleVec, rotationVec, -30.0f);
+    entity->addComponent<indie::ecs::component::Explodable>(range, BOMB_FUSE_SECONDS);
+    entity->getComponent<indie::ecs::component::Explodable>(indie::ecs::component::EXPLODABLE)->setPlayer(player);
+    entity->addComponent<indie::ecs::component::Transform>(x, y, static_cast<float>(0.0), static_cast<float>(0.0));
+    entity->addComponent<indie::ecs::component::Sound>(BOMB_SOUND_PATH, false);
+    entity->getComponent<indie::ecs::component::Sound>(indie::ecs::component::SOUND)
+        ->setCategory(indie::audio::SoundCategory::GAMEPLAY);
+    this->_explodeSystem->arm(entity.get(),
+        fuseTicks >= 0 ? static_cast<std::uint32_t>(fuseTicks)
+                       : entity->getComponent<indie::ecs::component::Explodable>(indie::ecs::component::EXPLODABLE)
+                             ->getFuseTicks());
+    addEntity(std::move(entity));
+}
+
+void indie::menu::GameScreen::driveBots()
+{
+    std::array<indie::ai::Bot::Decision, MAX_PLAYERS> decisions;
+    std::array<bool, MAX_PLAYERS> decided = {};
+    // A bot only reads the board and the danger map and writes its own state, the bots decide in parallel
+    auto decide = [this, &decisions, &decided](std::size_t first, std::size_t last) {
+        for (std::size_t index = first; index < last; index++) {
+            const player::Player &player = this->_players->at(index);
+            const indie::ecs::system::InputSystem::Handle &handle =
+                this->_inputSystem->getHandle(static_cast<int>(index));
+
+            if (!player.getIsBot() || !player.getIsPlaying() || !player.getIsAlive() || handle.transform == nullptr)
+                continue;
+            indie::ai::Bot::Situation self = {handle.transform->getX(), handle.transform->getY(),
+                static_cast<int>(player.getBombRadius()), player.getBombStock() > 0, player.getSpeed(),
+                BOMB_FUSE_SECONDS * TICKS_PER_SECOND, this->_explodeSystem->getTick()};
+            std::uint32_t phase = static_cast<std::uint32_t>(index % BOT_REPLAN_PERIOD_TICKS);
+            // Every bot plans afresh on the keyframe ticks, a seek to a keyframe then decides as the recording did
+            bool replan = indie::ecs::system::Scheduler::isDue({BOT_REPLAN_PERIOD_TICKS, phase}, this->_tick)
+                || this->_tick % indie::replay::Replay::KEYFRAME_INTERVAL == 0;
+            decisions[index] =
+                this->_bots[index].decide(this->_board, this->_explodeSystem->getDangerMap(), self, replan);
+            decided[index] = true;
         }
+    };
+
+    while (this->_bots.size() < this->_players->size())
+        this->_bots.emplace_back(static_cast<int>(this->_bots.size()));
+    if (this->_jobs != nullptr)
+        this->_jobs->parallelFor(this->_players->size(), 1, decide);
+    else
+        decide(0, this->_players->size());
+    // Commands are set in seat order whatever thread decided them
+    for (std::size_t index = 0; index < this->_players->size(); index++)
+        if (decided[index])
+            this->_inputSystem->setCommand(
+                static_cast<int>(index), {decisions[index].direction, decisions[index].bomb});
+}
+
+void indie::menu::GameScreen::placeRequestedBombs()
+{
+    for (int index = 0; index < this->_inputSystem->getHandleCount() && index < static_cast<int>(this->_players->size());
+         index++) {
+        const indie::ecs::system::InputSystem::Handle &handle = this->_inputSystem->getHandle(index);
+
+        if (handle.entity == nullptr || !handle.control->getBombRequested() || handle.transform == nullptr
+            || this->_players->at(index).getBombStock() <= 0)
+            continue;
+        float range = static_cast<float>((this->_players->at(index).getBombRadius()) * 2.0f);
+
+        spawnBomb(index, handle.transform->getX(), handle.transform->getY(), range);
+        this->_journal.bombPlaced(index, handle.transform->getX(), handle.transform->getY(), range);
+        this->_players->at(index).setBombStock(this->_players->at(index).getBombStock() - 1);
     }
-    if (event.controller[index].code == indie::Event::X_BUTTON) {
-        for (auto &entity : _entities) {
-            if (entity->getEntityType() == type) {
-                transformCompo =
-                    entity->getComponent<indie::ecs::component::Transform>(indie::ecs::component::compoType::TRANSFORM);
-            }
-        }
-        if (transformCompo != nullptr && this->_players->at(index).getBombStock() > 0) {
-            std::unique_ptr<indie::ecs::entity::Entity> entity =
-                std::make_unique<indie::ecs::entity::Entity>(indie::ecs::entity::entityType::BOMB);
-            indie::vec3f scaleVec({1.0f, 1.0f, 1.0f});
-            indie::vec3f rotationVec({1.0f, 0.0f, 0.0f});
-
-            entity->addComponent<indie::ecs::component::Object>(
-                "assets/objects/Bomb/Bomb.png", "assets/objects/Bomb/bomb.obj", scaleVec, rotationVec, -30.0f);
-            entity->addComponent<indie::ecs::component::Explodable>(
-                static_cast<float>((this->_players->at(index).getBombRadius()) * 2.0f), 2);
-            entity->getComponent<indie::ecs::component::Explodable>(indie::ecs::component::EXPLODABLE)
-                ->setPlayer(index);
-            entity->addComponent<indie::ecs::component::Transform>(static_cast<float>(transformCompo->getX()),
-                static_cast<float>(transformCompo->getY()), static_cast<float>(0.0), static_cast<float>(0.0));
-            addEntity(std::move(entity));
-            this->_players->at(index).setBombStock(this->_players->at(index).getBombStock() - 1);
-        }
+}
+
+void indie::menu::GameScreen::playExplosionSound()
+{
+    auto sound = _soundEntities->at(0)->getComponent<ecs::component::Sound>(ecs::component::compoType::SOUND);
+    ::Vector3 camera = this->_camera.getPosition();
+    auto priority = [&camera](float x, float y) {
+        float dx = x - camera.x;
+        float dy = camera.y;
+        float dz = y - camera.z;
+        return (-(dx * dx + dy * dy + dz * dz));
+    };
+
+    if (_muted)
+        return;
+    // Every bomb exploding this tick gets its sound, the closest to the camera have the highest priority
+    for (auto &entity : _entities) {
+        if (!entity->hasCompoType(indie::ecs::component::EXPLODABLE)
+            || !entity->hasCompoType(indie::ecs::component::SOUND))
+            continue;
+        auto bomb = entity->getComponent<indie::ecs::component::Explodable>(indie::ecs::component::EXPLODABLE);
+        if (!bomb->getExplode() || bomb->getExploded())
+            continue;
+        auto transform = entity->getComponent<indie::ecs::component::Transform>(indie::ecs::component::TRANSFORM);
+        auto bombSound = entity->getComponent<indie::ecs::component::Sound>(indie::ecs::component::SOUND);
+        // Posted by the sound system of the tick, next to the movement
+        bombSound->setPriority(priority(transform->getX(), transform->getY()));
+        bombSound->setPlay(true);
     }
-    // If a bomb is exploded, set the bomb sound.
-    if (_entities.back()->hasCompoType(indie::ecs::component::EXPLODABLE) == true) {
-        auto bomb =
-            _entities.back()->getComponent<indie::ecs::component::Explodable>(indie::ecs::component::EXPLODABLE);
-        if (bomb->getExplode() == true) {
-            _soundEntities->at(0)->getComponent<ecs::component::Sound>(ecs::component::compoType::SOUND)->setPlay(true);
-            for (auto &system : *this->_soundSystems) {
-                system->update(*this->_soundEntities);
-            }
-            _soundEntities->at(0)
-                ->getComponent<ecs::component::Sound>(ecs::component::compoType::SOUND)
-                ->setPlay(false);
+    // The chained bombs went off in the last update and are gone, their sound is posted right away
+    for (int tile : this->_explodeSystem->getChained()) {
+        sound->setPriority(priority(indie::board::Board::getTileX(tile), indie::board::Board::getTileY(tile)));
+        sound->setPlay(true);
+        for (auto &system : *this->_soundSystems) {
+            system->update(*this->_soundEntities);
         }
+        sound->setPlay(false);
     }
+    sound->setPriority(0.0f);
 }
 
 int indie::menu::GameScreen::handleEvent(indie::Event &event)
 {
     if (!_is_game_finished) {
-        if (this->_players->at(0).getIsPlaying() && this->_players->at(0).getIsAlive())
-            handleMultipleController(event, 0, indie::ecs::entity::entityType::PLAYER_1);
-        if (this->_players->at(1).getIsPlaying() && this->_players->at(1).getIsAlive())
-            handleMultipleController(event, 1, indie::ecs::entity::entityType::PLAYER_2);
-        if (this->_players->at(2).getIsPlaying() && this->_players->at(2).getIsAlive())
-            handleMultipleController(event, 2, indie::ecs::entity::entityType::PLAYER_3);
-        if (this->_players->at(3).getIsPlaying() && this->_players->at(3).getIsAlive())
-            handleMultipleController(event, 3, indie::ecs::entity::entityType::PLAYER_4);
+        // The tick is not simulated before the pause, it runs once on resume with the input recorded last for it
         if (event.controller[0].code == indie::Event::ControllerCode::OPTION_BUTTON || event.key.r_shift)
             return 4;
+        this->_board.sync(this->_entities, &this->_explodeSystem->getFlameField());
+        this->_explodeSystem->getDangerMap().setWalls(this->_board.getWalls());
+        driveBots();
+        this->_inputSystem->setEvent(event);
+        this->_inputSystem->update(this->_entities);
+        placeRequestedBombs();
+        playExplosionSound();
         if (countAlivePlayers() == 1)
             _is_game_finished = true;
     } else {
@@ -355,173 +502,106 @@ int indie::menu::GameScreen::handleEvent(indie::Event &event)
     return 0;
 }
 
-void indie::menu::GameScreen::initMap(std::vector<std::vector<char>> map)
+void indie::menu::GameScreen::spawnWall(float x, float y)
 {
-    float posX = -20.0;
-    float posY = 20.0;
+    std::unique_ptr<indie::ecs::entity::Entity> entity =
+        std::make_unique<indie::ecs::entity::Entity>(indie::ecs::entity::entityType::WALL);
+    entity->addComponent<indie::ecs::component::Transform>(x, y, static_cast<float>(0.0), static_cast<float>(0.0));
+    entity->addComponent<indie::ecs::component::Drawable3D>(
+        "src/wall.png", static_cast<float>(2.0), static_cast<float>(2.0), static_cast<float>(2.0), WHITE);
+    entity->addComponent<indie::ecs::component::Collide>();
+    addEntity(std::move(entity));
+}
+
+void indie::menu::GameScreen::spawnBox(float x, float y)
+{
+    std::unique_ptr<indie::ecs::entity::Entity> entity =
+        std::make_unique<indie::ecs::entity::Entity>(indie::ecs::entity::entityType::BOXES);
+    entity->addComponent<indie::ecs::component::Transform>(x, y, static_cast<float>(0.0), static_cast<float>(0.0));
+    entity->addComponent<indie::ecs::component::Collide>();
+    entity->addComponent<indie::ecs::component::Destroyable>();
+    entity->addComponent<indie::ecs::component::Drawable3D>(
+        "src/boite.png", static_cast<float>(2.0), static_cast<float>(2.0), static_cast<float>(2.0), WHITE);
+    addEntity(std::move(entity));
+}
+
+void indie::menu::GameScreen::spawnBonus(indie::ecs::component::bonusType bonus, float x, float y)
+{
+    std::unique_ptr<indie::ecs::entity::Entity> entity =
+        std::make_unique<indie::ecs::entity::Entity>(indie::ecs::entity::UNKNOWN);
+    vec3f scale({1.0f, 1.0f, 1.0f});
+
+    entity->addComponent<indie::ecs::component::Transform>(x, y, static_cast<float>(0.0), static_cast<float>(0.0));
+    if (bonus == indie::ecs::component::BOMBUP)
+        entity->addComponent<indie::ecs::component::Object>("assets/objects/Charger/charger.png",
+            "assets/objects/Charger/charger.obj", scale, vec3f({0.0f, 1.0f, 0.0f}), 90.0f);
+    else if (bonus == indie::ecs::component::SPEEDUP)
+        entity->addComponent<indie::ecs::component::Object>(
+            "assets/objects/Boot/boot.png", "assets/objects/Boot/boot.obj", scale, vec3f({0.0f, 1.0f, 0.0f}), 90.0f);
+    else
+        entity->addComponent<indie::ecs::component::Object>(
+            "assets/objects/Tnt/tnt.png", "assets/objects/Tnt/tnt.obj", scale, vec3f({0.0f, 0.0f, 1.0f}), 90.0f);
+    entity->addComponent<indie::ecs::component::Collectable>(bonus);
+    entity->addComponent<indie::ecs::component::Collide>();
+    addEntity(std::move(entity));
+}
+
+void indie::menu::GameScreen::spawnPlayer(int player, float x, float y, bool alive)
+{
+    static const char *textures[] = {"./assets/player/textures/blue.png", "./assets/player/textures/red.png",
+        "./assets/player/textures/green.png", "./assets/player/textures/yellow.png"};
+    std::unique_ptr<indie::ecs::entity::Entity> entity =
+        std::make_unique<indie::ecs::entity::Entity>(indie::ecs::entity::entityType::PLAYER);
     indie::vec3f scalePlayerVec({1.0f, 1.0f, 1.0f});
     indie::vec3f rotationPlayerVec({0.f, 1.f, 0.f});
 
+    entity->addComponent<indie::ecs::component::Transform>(x, y, static_cast<float>(0.0), static_cast<float>(0.0));
+    entity->addComponent<indie::ecs::component::Object>(textures[player % 4], "./assets/player/player.iqm",
+        "./assets/player/player.iqm", scalePlayerVec, rotationPlayerVec,
+        static_cast<float>(player % 4 < 2 ? ecs::component::Object::SOUTH : ecs::component::Object::NORTH));
+    entity->addComponent<indie::ecs::component::Destroyable>();
+    entity->addComponent<indie::ecs::component::Inventory>();
+    entity->addComponent<indie::ecs::component::Collide>();
+    entity->addComponent<indie::ecs::component::Alive>(alive);
+    entity->addComponent<indie::ecs::component::PlayerControl>(player);
+    this->_inputSystem->bindPlayer(entity.get());
+    addEntity(std::move(entity));
+}
+
+void indie::menu::GameScreen::initMap(
+    std::vector<std::vector<char>> map, const std::vector<std::pair<int, int>> &spawns)
+{
+    float posX = -20.0;
+    float posY = 20.0;
+
     for (int i = 0; i < 21; i++) {
         for (int j = 0; j < 21; j++) {
-            if (map[i][j] == '#') {
-                std::unique_ptr<indie::ecs::entity::Entity> entityX =
-                    std::make_unique<indie::ecs::entity::Entity>(indie::ecs::entity::entityType::WALL);
-                entityX->addComponent<indie::ecs::component::Transform>(static_cast<float>(posX),
-                    static_cast<float>(posY), static_cast<float>(0.0), static_cast<float>(0.0));
-                entityX->addComponent<indie::ecs::component::Drawable3D>(
-                    "src/wall.png", static_cast<float>(2.0), static_cast<float>(2.0), static_cast<float>(2.0), WHITE);
-                entityX->addComponent<indie::ecs::component::Collide>();
-                addEntity(std::move(entityX));
-            }
-            if (map[i][j] == '.') {
-                std::unique_ptr<indie::ecs::entity::Entity> entityA =
-                    std::make_unique<indie::ecs::entity::Entity>(indie::ecs::entity::entityType::BOXES);
-                entityA->addComponent<indie::ecs::component::Transform>(static_cast<float>(posX),
-                    static_cast<float>(posY), static_cast<float>(0.0), static_cast<float>(0.0));
-                entityA->addComponent<indie::ecs::component::Collide>();
-                entityA->addComponent<indie::ecs::component::Destroyable>();
-                entityA->addComponent<indie::ecs::component::Drawable3D>(
-                    "src/boite.png", static_cast<float>(2.0), static_cast<float>(2.0), static_cast<float>(2.0), WHITE);
-                addEntity(std::move(entityA));
-            }
-            if (map[i][j] == '1') {
-                std::unique_ptr<indie::ecs::entity::Entity> entityP1 =
-                    std::make_unique<indie::ecs::entity::Entity>(indie::ecs::entity::entityType::PLAYER_1);
-
-                entityP1->addComponent<indie::ecs::component::Transform>(static_cast<float>(posX),
-                    static_cast<float>(posY), static_cast<float>(0.0), static_cast<float>(0.0));
-                entityP1->addComponent<indie::ecs::component::Object>("./assets/player/textures/blue.png",
-                    "./assets/player/player.iqm", "./assets/player/player.iqm", scalePlayerVec, rotationPlayerVec,
-                    static_cast<float>(ecs::component::Object::SOUTH));
-                entityP1->addComponent<indie::ecs::component::Destroyable>();
-                entityP1->addComponent<indie::ecs::component::Inventory>();
-                entityP1->addComponent<indie::ecs::component::Collide>();
-                entityP1->addComponent<indie::ecs::component::Alive>(true);
-                addEntity(std::move(entityP1));
-            }
-            if (_player2_red) {
-                if (map[i][j] == '2') {
-                    std::unique_ptr<indie::ecs::entity::Entity> entityP2 =
-                        std::make_unique<indie::ecs::entity::Entity>(indie::ecs::entity::PLAYER_2);
-                    entityP2->addComponent<indie::ecs::component::Transform>(static_cast<float>(posX),
-                        static_cast<float>(posY), static_cast<float>(0.0), static_cast<float>(0.0));
-                    entityP2->addComponent<indie::ecs::component::Object>("./assets/player/textures/red.png",
-                        "./assets/player/player.iqm", "./assets/player/player.iqm", scalePlayerVec, rotationPlayerVec,
-                        static_cast<float>(ecs::component::Object::SOUTH));
-                    entityP2->addComponent<indie::ecs::component::Destroyable>();
-                    entityP2->addComponent<indie::ecs::component::Inventory>();
-                    entityP2->addComponent<indie::ecs::component::Collide>();
-                    entityP2->addComponent<indie::ecs::component::Alive>(true);
-                    addEntity(std::move(entityP2));
-                }
-            }
-            if (_player3_green) {
-                if (map[i][j] == '3') {
-                    std::unique_ptr<indie::ecs::entity::Entity> entityP3 =
-                        std::make_unique<indie::ecs::entity::Entity>(indie::ecs::entity::PLAYER_3);
-                    entityP3->addComponent<indie::ecs::component::Transform>(static_cast<float>(posX),
-                        static_cast<float>(posY), static_cast<float>(0.0), static_cast<float>(0.0));
-                    entityP3->addComponent<indie::ecs::component::Object>("./assets/player/textures/green.png",
-                        "./assets/player/player.iqm", "./assets/player/player.iqm", scalePlayerVec, rotationPlayerVec,
-                        static_cast<float>(ecs::component::Object::NORTH));
-                    entityP3->addComponent<indie::ecs::component::Destroyable>();
-                    entityP3->addComponent<indie::ecs::component::Inventory>();
-                    entityP3->addComponent<indie::ecs::component::Collide>();
-                    entityP3->addComponent<indie::ecs::component::Alive>(true);
-                    addEntity(std::move(entityP3));
-                }
-            }
-            if (_player4_yellow) {
-                if (map[i][j] == '4') {
-                    std::unique_ptr<indie::ecs::entity::Entity> entityP4 =
-                        std::make_unique<indie::ecs::entity::Entity>(indie::ecs::entity::PLAYER_4);
-                    entityP4->addComponent<indie::ecs::component::Transform>(static_cast<float>(posX),
-                        static_cast<float>(posY), static_cast<float>(0.0), static_cast<float>(0.0));
-                    entityP4->addComponent<indie::ecs::component::Object>("./assets/player/textures/yellow.png",
-                        "./assets/player/player.iqm", "./assets/player/player.iqm", scalePlayerVec, rotationPlayerVec,
-                        static_cast<float>(ecs::component::Object::NORTH));
-                    entityP4->addComponent<indie::ecs::component::Destroyable>();
-                    entityP4->addComponent<indie::ecs::component::Inventory>();
-                    entityP4->addComponent<indie::ecs::component::Collide>();
-                    entityP4->addComponent<indie::ecs::component::Alive>(true);
-                    addEntity(std::move(entityP4));
-                }
-            }
-            if (map[i][j] == 'B') {
-                std::unique_ptr<indie::ecs::entity::Entity> entityB =
-                    std::make_unique<indie::ecs::entity::Entity>(indie::ecs::entity::UNKNOWN);
-                entityB->addComponent<indie::ecs::component::Transform>(static_cast<float>(posX),
-                    static_cast<float>(posY), static_cast<float>(0.0), static_cast<float>(0.0));
-                vec3f scale({1.0f, 1.0f, 1.0f});
-                vec3f rotation({0.0f, 1.0f, 0.0f});
-
-                entityB->addComponent<indie::ecs::component::Object>(
-                    "assets/objects/Charger/charger.png", "assets/objects/Charger/charger.obj", scale, rotation, 90.0f);
-                entityB->addComponent<indie::ecs::component::Collectable>(indie::ecs::component::BOMBUP);
-                entityB->addComponent<indie::ecs::component::Collide>();
-                addEntity(std::move(entityB));
-                std::unique_ptr<indie::ecs::entity::Entity> entityB2 =
-                    std::make_unique<indie::ecs::entity::Entity>(indie::ecs::entity::BOXES);
-                entityB2->addComponent<indie::ecs::component::Transform>(static_cast<float>(posX),
-                    static_cast<float>(posY), static_cast<float>(0.0), static_cast<float>(0.0));
-                entityB2->addComponent<indie::ecs::component::Collide>();
-                entityB2->addComponent<indie::ecs::component::Destroyable>();
-                entityB2->addComponent<indie::ecs::component::Drawable3D>(
-                    "src/boite.png", static_cast<float>(2.0), static_cast<float>(2.0), static_cast<float>(2.0), WHITE);
-                addEntity(std::move(entityB2));
-            }
-            if (map[i][j] == 'S') {
-                std::unique_ptr<indie::ecs::entity::Entity> entityS =
-                    std::make_unique<indie::ecs::entity::Entity>(indie::ecs::entity::UNKNOWN);
-                entityS->addComponent<indie::ecs::component::Transform>(static_cast<float>(posX),
-                    static_cast<float>(posY), static_cast<float>(0.0), static_cast<float>(0.0));
-                vec3f scale({1.0f, 1.0f, 1.0f});
-                vec3f rotation({0.0f, 1.0f, 0.0f});
-
-                entityS->addComponent<indie::ecs::component::Object>(
-                    "assets/objects/Boot/boot.png", "assets/objects/Boot/boot.obj", scale, rotation, 90.0f);
-                entityS->addComponent<indie::ecs::component::Collectable>(indie::ecs::component::SPEEDUP);
-                entityS->addComponent<indie::ecs::component::Collide>();
-                addEntity(std::move(entityS));
-                std::unique_ptr<indie::ecs::entity::Entity> entityS2 =
-                    std::make_unique<indie::ecs::entity::Entity>(indie::ecs::entity::BOXES);
-                entityS2->addComponent<indie::ecs::component::Transform>(static_cast<float>(posX),
-                    static_cast<float>(posY), static_cast<float>(0.0), static_cast<float>(0.0));
-                entityS2->addComponent<indie::ecs::component::Collide>();
-                entityS2->addComponent<indie::ecs::component::Destroyable>();
-                entityS2->addComponent<indie::ecs::component::Drawable3D>(
-                    "src/boite.png", static_cast<float>(2.0), static_cast<float>(2.0), static_cast<float>(2.0), WHITE);
-                addEntity(std::move(entityS2));
-            }
-            if (map[i][j] == 'R') {
-                std::unique_ptr<indie::ecs::entity::Entity> entityR =
-                    std::make_unique<indie::ecs::entity::Entity>(indie::ecs::entity::UNKNOWN);
-                entityR->addComponent<indie::ecs::component::Transform>(static_cast<float>(posX),
-                    static_cast<float>(posY), static_cast<float>(0.0), static_cast<float>(0.0));
-                vec3f scale({1.0f, 1.0f, 1.0f});
-                vec3f rotation({0.0f, 0.0f, 1.0f});
-
-                entityR->addComponent<indie::ecs::component::Object>(
-                    "assets/objects/Tnt/tnt.png", "assets/objects/Tnt/tnt.obj", scale, rotation, 90.0f);
-                entityR->addComponent<indie::ecs::component::Collectable>(indie::ecs::component::bonusType::FIREUP);
-                entityR->addComponent<indie::ecs::component::Collide>();
-                addEntity(std::move(entityR));
-                std::unique_ptr<indie::ecs::entity::Entity> entityR2 =
-                    std::make_unique<indie::ecs::entity::Entity>(indie::ecs::entity::BOXES);
-                entityR2->addComponent<indie::ecs::component::Transform>(static_cast<float>(posX),
-                    static_cast<float>(posY), static_cast<float>(0.0), static_cast<float>(0.0));
-                entityR2->addComponent<indie::ecs::component::Collide>();
-                entityR2->addComponent<indie::ecs::component::Destroyable>();
-                entityR2->addComponent<indie::ecs::component::Drawable3D>(
-                    "src/boite.png", static_cast<float>(2.0), static_cast<float>(2.0), static_cast<float>(2.0), WHITE);
-                addEntity(std::move(entityR2));
+            switch (map[i][j]) {
+                case '#': spawnWall(posX, posY); break;
+                case '.': spawnBox(posX, posY); break;
+                case 'B':
+                    spawnBonus(indie::ecs::component::BOMBUP, posX, posY);
+                    spawnBox(posX, posY);
+                    break;
+                case 'S':
+                    spawnBonus(indie::ecs::component::SPEEDUP, posX, posY);
+                    spawnBox(posX, posY);
+                    break;
+                case 'R':
+                    spawnBonus(indie::ecs::component::FIREUP, posX, posY);
+                    spawnBox(posX, posY);
+                    break;
+                default: break;
             }
             posX += 2.0;
         }
         posY -= 2.0;
         posX = -20;
     }
+    for (size_t player = 0; player < spawns.size() && player < this->_players->size(); player++)
+        if (this->_players->at(player).getIsPlaying())
+            spawnPlayer(static_cast<int>(player), -20.0f + 2.0f * static_cast<float>(spawns[player].second),
+                20.0f - 2.0f * static_cast<float>(spawns[player].first));
 }
 
 bool indie::menu::GameScreen::compareColor(Color a, Color b)
@@ -529,78 +609,75 @@ bool indie::menu::GameScreen::compareColor(Color a, Color b)
     return (a.a == b.a && a.b == b.b && a.g == b.g && a.r == b.r);
 }
 
-void indie::menu::GameScreen::saveMapEntities()
+void indie::menu::GameScreen::saveMapEntities(const std::string &path)
 {
-    remove("SaveFile.txt");
+    remove(path.c_str());
     std::fstream file;
-    file.open("SaveFile.txt", std::fstream::in | std::fstream::out | std::fstream::app);
-    bool mapEnd = false;
+    file.open(path, std::fstream::in | std::fstream::out | std::fstream::app);
+    file.precision(std::numeric_limits<float>::max_digits10);
 
-    for (int i = 0; i < 4; i++) {
-        file << "P" << i << " " << i << " " << this->_players->at(i).getIsAlive() << " "
+    for (size_t i = 0; i < this->_players->size(); i++) {
+        file << "P" << i << " " << this->_players->at(i).getControllerId() << " " << this->_players->at(i).getIsAlive()
+             << " "
              << this->_players->at(i).getIsPlaying() << " " << this->_players->at(i).getBombRadius() << " "
              << this->_players->at(i).getBombStock() << " " << this->_players->at(i).getMaxBombStock() << " "
-             << this->_players->at(i).getSpeed() << std::endl;
-    }
-    for (int i = 1; !mapEnd; i++) {
-        if (_entities.at(i)->getEntityType() == indie::ecs::entity::entityType::WALL) {
-            file << "# ";
-            ecs::component::Transform *transformCompo =
-                _entities.at(i)->getComponent<ecs::component::Transform>(ecs::component::compoType::TRANSFORM);
-            file << transformCompo->getX() << " " << transformCompo->getY() << std::endl;
-            if (transformCompo->getX() == 20 && transformCompo->getY() == -20)
-                mapEnd = true;
-        }
-        if (_entities.at(i)->getEntityType() == indie::ecs::entity::entityType::BOXES) {
-            file << ". ";
-            ecs::component::Transform *transformCompo =
-                _entities.at(i)->getComponent<ecs::component::Transform>(ecs::component::compoType::TRANSFORM);
-            file << transformCompo->getX() << " " << transformCompo->getY() << std::endl;
-        }
-        if (_entities.at(i)->getEntityType() == indie::ecs::entity::entityType::PLAYER_1) {
-            file << "1 ";
-            ecs::component::Transform *transformCompo =
-                _entities.at(i)->getComponent<ecs::component::Transform>(ecs::component::compoType::TRANSFORM);
-            file << transformCompo->getX() << " " << transformCompo->getY() << std::endl;
-        }
-        if (_entities.at(i)->getEntityType() == indie::ecs::entity::entityType::PLAYER_2) {
-            file << "2 ";
-            ecs::component::Transform *transformCompo =
-                _entities.at(i)->getComponent<ecs::component::Transform>(ecs::component::compoType::TRANSFORM);
-            file << transformCompo->getX() << " " << transformCompo->getY() << std::endl;
-        }
-        if (_entities.at(i)->getEntityType() == indie::ecs::entity::entityType::PLAYER_3) {
-            file << "3 ";
-            ecs::component::Transform *transformCompo =
-                _entities.at(i)->getComponent<ecs::component::Transform>(ecs::component::compoType::TRANSFORM);
-            file << transformCompo->getX() << " " << transformCompo->getY() << std::endl;
-        }
-        if (_entities.at(i)->getEntityType() == indie::ecs::entity::entityType::PLAYER_4) {
-            file << "4 ";
-            ecs::component::Transform *transformCompo =
-                _entities.at(i)->getComponent<ecs::component::Transform>(ecs::component::compoType::TRANSFORM);
-            file << transformCompo->getX() << " " << transformCompo->getY() << std::endl;
-        }
-        if (_entities.at(i)->getEntityType() == indie::ecs::entity::entityType::UNKNOWN) {
-            ecs::component::Transform *transformCompo =
-                _entities.at(i)->getComponent<ecs::component::Transform>(ecs::component::compoType::TRANSFORM);
-            ecs::component::Collectable *collectableCompo =
-                _entities.at(i)->getComponent<ecs::component::Collectable>(ecs::component::compoType::COLLECTABLE);
-            if (collectableCompo->getBonusType() == indie::ecs::component::BOMBUP)
-                file << "B " << transformCompo->getX() << " " << transformCompo->getY() << std::endl;
-            if (collectableCompo->getBonusType() == indie::ecs::component::SPEEDUP)
-                file << "S " << transformCompo->getX() << " " << transformCompo->getY() << std::endl;
-            if (collectableCompo->getBonusType() == indie::ecs::component::FIREUP)
-                file << "R " << transformCompo->getX() << " " << transformCompo->getY() << std::endl;
+             << this->_players->at(i).getSpeed() << " " << this->_players->at(i).getIsBot() << std::endl;
+    }
+    for (auto &entity : this->_entities) {
+        ecs::component::Transform *transformCompo =
+            entity->getComponent<ecs::component::Transform>(ecs::component::compoType::TRANSFORM);
+        if (transformCompo == nullptr)
+            continue;
+        switch (entity->getEntityType()) {
+            case indie::ecs::entity::entityType::WALL: file << "# "; break;
+            case indie::ecs::entity::entityType::BOXES: file << ". "; break;
+            case indie::ecs::entity::entityType::PLAYER: {
+                auto controlCompo =
+                    entity->getComponent<ecs::component::PlayerControl>(ecs::component::compoType::PLAYERCONTROL);
+                if (controlCompo == nullptr)
+                    continue;
+                file << controlCompo->getPlayer() + 1 << " ";
+                break;
+            }
+            case indie::ecs::entity::entityType::BOMB: {
+                auto explodableCompo =
+                    entity->getComponent<ecs::component::Explodable>(ecs::component::compoType::EXPLODABLE);
+                if (explodableCompo == nullptr || explodableCompo->getExploded())
+                    continue;
+                file << "O " << explodableCompo->getPlayer() << " " << explodableCompo->getRange() << " ";
+                break;
+            }
+            case indie::ecs::entity::entityType::UNKNOWN: {
+                ecs::component::Collectable *collectableCompo =
+                    entity->getComponent<ecs::component::Collectable>(ecs::component::compoType::COLLECTABLE);
+                if (collectableCompo == nullptr)
+                    continue;
+                if (collectableCompo->getBonusType() == indie::ecs::component::BOMBUP)
+                    file << "B ";
+                else if (collectableCompo->getBonusType() == indie::ecs::component::SPEEDUP)
+                    file << "S ";
+                else if (collectableCompo->getBonusType() == indie::ecs::component::FIREUP)
+                    file << "R ";
+                else
+                    continue;
+                break;
+            }
+            default: continue;
         }
+        file << transformCompo->getX() << " " << transformCompo->getY();
+        if (entity->getEntityType() == indie::ecs::entity::entityType::BOMB)
+            file << " "
+                 << this->_explodeSystem->getRemainingTicks(
+                        entity->getComponent<ecs::component::Explodable>(ecs::component::compoType::EXPLODABLE));
+        file << std::endl;
     }
     file.close();
 }
 
-bool indie::menu::GameScreen::loadSavedMap()
+bool indie::menu::GameScreen::loadSavedMap(const std::string &path)
 {
     std::ifstream file;
-    file.open("SaveFile.txt");
+    file.open(path);
     std::string line;
     if (file.is_open()) {
         this->_players->clear();
@@ -618,193 +695,209 @@ bool indie::menu::GameScreen::loadSavedMap()
     } else
         return false;
     file.close();
+    forgetBotPlans();
     return true;
 }
 
-void indie::menu::GameScreen::initRightEntity(std::vector<std::string> args)
+void indie::menu::GameScreen::enableAutosave(size_t checkpointSeconds)
 {
-    indie::vec3f scalePlayerVec({1.0f, 1.0f, 1.0f});
-    indie::vec3f rotationPlayerVec({0.f, 1.f, 0.f});
+    this->_checkpointInterval = std::chrono::seconds(checkpointSeconds);
+    if (!this->_journal.open(AUTOSAVE_JOURNAL_PATH)) {
+        std::cerr << "Autosave disabled: cannot open " << AUTOSAVE_JOURNAL_PATH << std::endl;
+        return;
+    }
+    this->_journal.beginTick(this->_tick);
+    this->_journaledPlayers.clear();
+    writeCheckpoint();
+}
 
-    if (args[0] == "#") {
-        std::unique_ptr<indie::ecs::entity::Entity> entityX =
-            std::make_unique<indie::ecs::entity::Entity>(indie::ecs::entity::entityType::WALL);
-        entityX->addComponent<indie::ecs::component::Transform>(static_cast<float>(std::stof(args[1])),
-            static_cast<float>(std::stof(args[2])), static_cast<float>(0.0), static_cast<float>(0.0));
-        entityX->addComponent<indie::ecs::component::Drawable3D>(
-            "src/wall.png", static_cast<float>(2.0), static_cast<float>(2.0), static_cast<float>(2.0), WHITE);
-        entityX->addComponent<indie::ecs::component::Collide>();
-        addEntity(std::move(entityX));
-    }
-    if (args[0] == ".") {
-        std::unique_ptr<indie::ecs::entity::Entity> entityA =
-            std::make_unique<indie::ecs::entity::Entity>(indie::ecs::entity::entityType::BOXES);
-        entityA->addComponent<indie::ecs::component::Transform>(static_cast<float>(std::stof(args[1])),
-            static_cast<float>(std::stof(args[2])), static_cast<float>(0.0), static_cast<float>(0.0));
-        entityA->addComponent<indie::ecs::component::Collide>();
-        entityA->addComponent<indie::ecs::component::Destroyable>();
-        entityA->addComponent<indie::ecs::component::Drawable3D>(
-            "src/boite.png", static_cast<float>(2.0), static_cast<float>(2.0), static_cast<float>(2.0), WHITE);
-        addEntity(std::move(entityA));
-    }
-    if (args[0] == "1" && this->_players->at(0).getIsAlive() == true) {
-        std::unique_ptr<indie::ecs::entity::Entity> entityP1 =
-            std::make_unique<indie::ecs::entity::Entity>(indie::ecs::entity::entityType::PLAYER_1);
-
-        entityP1->addComponent<indie::ecs::component::Transform>(static_cast<float>(std::stof(args[1])),
-            static_cast<float>(std::stof(args[2])), static_cast<float>(0.0), static_cast<float>(0.0));
-        entityP1->addComponent<indie::ecs::component::Object>("./assets/player/textures/blue.png",
-            "./assets/player/player.iqm", "./assets/player/player.iqm", scalePlayerVec, rotationPlayerVec,
-            static_cast<float>(ecs::component::Object::SOUTH));
-        entityP1->addComponent<indie::ecs::component::Destroyable>();
-        entityP1->addComponent<indie::ecs::component::Inventory>();
-        entityP1->addComponent<indie::ecs::component::Collide>();
-        entityP1->addComponent<indie::ecs::component::Alive>(true);
-        addEntity(std::move(entityP1));
-        _player1_blue = true;
-    }
-    if (args[0] == "2" && this->_players->at(1).getIsAlive() == true) {
-        std::unique_ptr<indie::ecs::entity::Entity> entityP2 =
-            std::make_unique<indie::ecs::entity::Entity>(indie::ecs::entity::PLAYER_2);
-        entityP2->addComponent<indie::ecs::component::Transform>(static_cast<float>(std::stof(args[1])),
-            static_cast<float>(std::stof(args[2])), static_cast<float>(0.0), static_cast<float>(0.0));
-        entityP2->addComponent<indie::ecs::component::Object>("./assets/player/textures/red.png",
-            "./assets/player/player.iqm", "./assets/player/player.iqm", scalePlayerVec, rotationPlayerVec,
-            static_cast<float>(ecs::component::Object::SOUTH));
-        entityP2->addComponent<indie::ecs::component::Destroyable>();
-        entityP2->addComponent<indie::ecs::component::Inventory>();
-        entityP2->addComponent<indie::ecs::component::Collide>();
-        entityP2->addComponent<indie::ecs::component::Alive>(true);
-        addEntity(std::move(entityP2));
-        _player2_red = true;
-    }
-    if (args[0] == "3" && this->_players->at(2).getIsAlive() == true) {
-        std::unique_ptr<indie::ecs::entity::Entity> entityP3 =
-            std::make_unique<indie::ecs::entity::Entity>(indie::ecs::entity::PLAYER_3);
-        entityP3->addComponent<indie::ecs::component::Transform>(static_cast<float>(std::stof(args[1])),
-            static_cast<float>(std::stof(args[2])), static_cast<float>(0.0), static_cast<float>(0.0));
-        entityP3->addComponent<indie::ecs::component::Object>("./assets/player/textures/green.png",
-            "./assets/player/player.iqm", "./assets/player/player.iqm", scalePlayerVec, rotationPlayerVec,
-            static_cast<float>(ecs::component::Object::NORTH));
-        entityP3->addComponent<indie::ecs::component::Destroyable>();
-        entityP3->addComponent<indie::ecs::component::Inventory>();
-        entityP3->addComponent<indie::ecs::component::Collide>();
-        entityP3->addComponent<indie::ecs::component::Alive>(true);
-        addEntity(std::move(entityP3));
-        _player3_green = true;
-    }
-    if (args[0] == "4" && this->_players->at(3).getIsAlive() == true) {
-        std::unique_ptr<indie::ecs::entity::Entity> entityP4 =
-            std::make_unique<indie::ecs::entity::Entity>(indie::ecs::entity::PLAYER_4);
-        entityP4->addComponent<indie::ecs::component::Transform>(static_cast<float>(std::stof(args[1])),
-            static_cast<float>(std::stof(args[2])), static_cast<float>(0.0), static_cast<float>(0.0));
-        entityP4->addComponent<indie::ecs::component::Object>("./assets/player/textures/yellow.png",
-            "./assets/player/player.iqm", "./assets/player/player.iqm", scalePlayerVec, rotationPlayerVec,
-            static_cast<float>(ecs::component::Object::NORTH));
-        entityP4->addComponent<indie::ecs::component::Destroyable>();
-        entityP4->addComponent<indie::ecs::component::Inventory>();
-        entityP4->addComponent<indie::ecs::component::Collide>();
-        entityP4->addComponent<indie::ecs::component::Alive>(true);
-        addEntity(std::move(entityP4));
-        _player4_yellow = true;
-    }
-    if (args[0] == "B") {
-        std::unique_ptr<indie::ecs::entity::Entity> entityB =
-            std::make_unique<indie::ecs::entity::Entity>(indie::ecs::entity::UNKNOWN);
-        entityB->addComponent<indie::ecs::component::Transform>(static_cast<float>(std::stof(args[1])),
-            static_cast<float>(std::stof(args[2])), static_cast<float>(0.0), static_cast<float>(0.0));
-        vec3f scale({1.0f, 1.0f, 1.0f});
-        vec3f rotation({0.0f, 1.0f, 0.0f});
-
-        entityB->addComponent<indie::ecs::component::Object>(
-            "assets/objects/Charger/charger.png", "assets/objects/Charger/charger.obj", scale, rotation, 90.0f);
-        entityB->addComponent<indie::ecs::component::Collectable>(indie::ecs::component::BOMBUP);
-        entityB->addComponent<indie::ecs::component::Collide>();
-        addEntity(std::move(entityB));
-    }
-    if (args[0] == "S") {
-        std::unique_ptr<indie::ecs::entity::Entity> entityS =
-            std::make_unique<indie::ecs::entity::Entity>(indie::ecs::entity::UNKNOWN);
-        entityS->addComponent<indie::ecs::component::Transform>(static_cast<float>(std::stof(args[1])),
-            static_cast<float>(std::stof(args[2])), static_cast<float>(0.0), static_cast<float>(0.0));
-        vec3f scale({1.0f, 1.0f, 1.0f});
-        vec3f rotation({0.0f, 1.0f, 0.0f});
-
-        entityS->addComponent<indie::ecs::component::Object>(
-            "assets/objects/Boot/boot.png", "assets/objects/Boot/boot.obj", scale, rotation, 90.0f);
-        entityS->addComponent<indie::ecs::component::Collectable>(indie::ecs::component::SPEEDUP);
-        entityS->addComponent<indie::ecs::component::Collide>();
-        addEntity(std::move(entityS));
-    }
-    if (args[0] == "R") {
-        std::unique_ptr<indie::ecs::entity::Entity> entityR =
-            std::make_unique<indie::ecs::entity::Entity>(indie::ecs::entity::UNKNOWN);
-        entityR->addComponent<indie::ecs::component::Transform>(static_cast<float>(std::stof(args[1])),
-            static_cast<float>(std::stof(args[2])), static_cast<float>(0.0), static_cast<float>(0.0));
-        vec3f scale({1.0f, 1.0f, 1.0f});
-        vec3f rotation({0.0f, 0.0f, 1.0f});
-
-        entityR->addComponent<indie::ecs::component::Object>(
-            "assets/objects/Tnt/tnt.png", "assets/objects/Tnt/tnt.obj", scale, rotation, 90.0f);
-        entityR->addComponent<indie::ecs::component::Collectable>(indie::ecs::component::bonusType::FIREUP);
-        entityR->addComponent<indie::ecs::component::Collide>();
-        addEntity(std::move(entityR));
+void indie::menu::GameScreen::disableAutosave()
+{
+    this->_journal.close();
+    remove(AUTOSAVE_JOURNAL_PATH);
+    remove(AUTOSAVE_CHECKPOINT_PATH);
+}
+
+bool indie::menu::GameScreen::hasNewerAutosave(const std::string &savePath) const
+{
+    std::error_code error;
+    // The checkpoint is what a recovery needs, its date is the date of the autosave
+    std::filesystem::file_time_type autosaved = std::filesystem::last_write_time(AUTOSAVE_CHECKPOINT_PATH, error);
+
+    if (error)
+        return (false);
+    if (!std::filesystem::exists(savePath, error))
+        return (!error);
+    std::filesystem::file_time_type saved = std::filesystem::last_write_time(savePath, error);
+    if (error)
+        return (false);
+    return (autosaved > saved);
+}
+
+bool indie::menu::GameScreen::recoverAutosave()
+{
+    std::vector<indie::save::Journal::Record> records;
+    std::uint32_t lastTick = 0;
+
+    if (!loadSavedMap(AUTOSAVE_CHECKPOINT_PATH))
+        return (false);
+    records = indie::save::Journal::read(AUTOSAVE_JOURNAL_PATH);
+    for (auto &record : records)
+        lastTick = std::max(lastTick, record.tick);
+    for (auto &record : records)
+        applyRecord(record, lastTick);
+    forgetBotPlans();
+    return (true);
+}
+
+void indie::menu::GameScreen::forgetBotPlans()
+{
+    for (auto &bot : this->_bots)
+        bot.forget();
+}
+
+void indie::menu::GameScreen::writeCheckpoint()
+{
+    std::string tmpPath = std::string(AUTOSAVE_CHECKPOINT_PATH) + ".tmp";
+
+    this->_journal.commit();
+    saveMapEntities(tmpPath);
+    std::rename(tmpPath.c_str(), AUTOSAVE_CHECKPOINT_PATH);
+    this->_journal.truncate();
+    this->_lastCheckpoint = std::chrono::steady_clock::now();
+}
+
+void indie::menu::GameScreen::journalPlayers()
+{
+    this->_journaledPlayers.resize(this->_players->size());
+    for (auto &entity : this->_entities) {
+        auto controlCompo =
+            entity->getComponent<indie::ecs::component::PlayerControl>(indie::ecs::component::PLAYERCONTROL);
+        if (entity->getEntityType() != indie::ecs::entity::PLAYER || controlCompo == nullptr
+            || controlCompo->getPlayer() >= static_cast<int>(this->_players->size()))
+            continue;
+        int index = controlCompo->getPlayer();
+        auto transformCompo = entity->getComponent<indie::ecs::component::Transform>(indie::ecs::component::TRANSFORM);
+        player::Player &player = this->_players->at(index);
+        indie::save::Journal::Record &last = this->_journaledPlayers.at(index);
+        std::uint16_t flags = (player.getIsAlive() ? indie::save::Journal::PLAYER_ALIVE : 0)
+            | (player.getIsPlaying() ? indie::save::Journal::PLAYER_PLAYING : 0)
+            | (player.getIsBot() ? indie::save::Journal::PLAYER_BOT : 0);
+        std::int16_t stats[4] = {static_cast<std::int16_t>(player.getBombRadius()),
+            static_cast<std::int16_t>(player.getBombStock()), static_cast<std::int16_t>(player.getMaxBombStock()),
+            static_cast<std::int16_t>(player.getSpeed())};
+
+        if (last.type == indie::save::Journal::PLAYER_STATS && last.flags == flags && last.x == transformCompo->getX()
+            && last.y == transformCompo->getY() && std::equal(stats, stats + 4, last.values))
+            continue;
+        this->_journal.playerStats(index, flags, transformCompo->getX(), transformCompo->getY(), stats);
+        last = {this->_tick, indie::save::Journal::PLAYER_STATS, static_cast<std::uint8_t>(index), flags,
+            transformCompo->getX(), transformCompo->getY(), {stats[0], stats[1], stats[2], stats[3]}};
     }
-    if (args[0][0] == 'P') {
-        Color color;
-
-        switch (args[0][1]) {
-            case '0': color = BLUEPLAYERCOLOR; break;
-            case '1': color = REDPLAYERCOLOR; break;
-            case '2': color = GREENPLAYERCOLOR; break;
-            case '3': color = YELLOWPLAYERCOLOR; break;
-            default: BLUEPLAYERCOLOR; break;
+}
+
+void indie::menu::GameScreen::applyRecord(const indie::save::Journal::Record &record, std::uint32_t lastTick)
+{
+    if (record.type == indie::save::Journal::BOMB_PLACED) {
+        std::uint32_t fuse = BOMB_FUSE_SECONDS * TICKS_PER_SECOND;
+        // Ticks burnt before the crash are gone, a fuse already over goes off on the next tick
+        std::uint32_t burnt = std::min(fuse, lastTick - std::min(lastTick, record.tick));
+
+        spawnBomb(record.subject, record.x, record.y, static_cast<float>(record.values[0]),
+            static_cast<int>(fuse - burnt));
+    } else if (record.type == indie::save::Journal::PLAYER_STATS) {
+        if (record.subject >= this->_players->size())
+            return;
+        player::Player &player = this->_players->at(record.subject);
+        player.setIsAlive(record.flags & indie::save::Journal::PLAYER_ALIVE);
+        player.setIsPlaying(record.flags & indie::save::Journal::PLAYER_PLAYING);
+        player.setIsBot(record.flags & indie::save::Journal::PLAYER_BOT);
+        player.setBombRadius(record.values[0]);
+        player.setBombStock(record.values[1]);
+        player.setMaxBombStock(record.values[2]);
+        player.setSpeed(record.values[3]);
+        for (auto &entity : this->_entities) {
+            auto controlCompo =
+                entity->getComponent<indie::ecs::component::PlayerControl>(indie::ecs::component::PLAYERCONTROL);
+            if (entity->getEntityType() != indie::ecs::entity::PLAYER || controlCompo == nullptr
+                || controlCompo->getPlayer() != record.subject)
+                continue;
+            auto transformCompo =
+                entity->getComponent<indie::ecs::component::Transform>(indie::ecs::component::TRANSFORM);
+            transformCompo->setX(record.x);
+            transformCompo->setY(record.y);
+            if (entity->hasCompoType(indie::ecs::component::ALIVE))
+                entity->getComponent<indie::ecs::component::Alive>(indie::ecs::component::ALIVE)
+                    ->setAlive(player.getIsAlive());
         }
+    } else {
+        for (auto it = this->_entities.begin(); it != this->_entities.end(); ++it) {
+            auto transformCompo =
+                (*it)->getComponent<indie::ecs::component::Transform>(indie::ecs::component::TRANSFORM);
+            if ((*it)->getEntityType() != record.subject || transformCompo == nullptr
+                || std::abs(transformCompo->getX() - record.x) > 0.01f
+                || std::abs(transformCompo->getY() - record.y) > 0.01f)
+                continue;
+            if (record.subject == indie::ecs::entity::UNKNOWN
+                && !(*it)->hasCompoType(indie::ecs::component::COLLECTABLE))
+                continue;
+            // The fuse timers and the danger map point to the bombs, they must let go first
+            if ((*it)->hasCompoType(indie::ecs::component::EXPLODABLE))
+                this->_explodeSystem->disarm(it->get());
+            this->_entities.erase(it);
+            break;
+        }
+    }
+}
+
+void indie::menu::GameScreen::initRightEntity(std::vector<std::string> args)
+{
+    if (args[0] == "#")
+        spawnWall(std::stof(args[1]), std::stof(args[2]));
+    if (args[0] == ".")
+        spawnBox(std::stof(args[1]), std::stof(args[2]));
+    // Player entities are saved as their index plus one, after the "P" lines of every player
+    if (std::isdigit(static_cast<unsigned char>(args[0][0]))) {
+        size_t player = std::stoul(args[0]) - 1;
+        if (player < this->_players->size() && this->_players->at(player).getIsAlive())
+            spawnPlayer(static_cast<int>(player), std::stof(args[1]), std::stof(args[2]));
+    }
+    if (args[0] == "B")
+        spawnBonus(indie::ecs::component::BOMBUP, std::stof(args[1]), std::stof(args[2]));
+    if (args[0] == "S")
+        spawnBonus(indie::ecs::component::SPEEDUP, std::stof(args[1]), std::stof(args[2]));
+    if (args[0] == "R")
+        spawnBonus(indie::ecs::component::FIREUP, std::stof(args[1]), std::stof(args[2]));
+    if (args[0] == "O") {
+        // Saves older than the tick based fuses have no remaining fuse, the bomb gets a full one
+        spawnBomb(std::stoi(args[1]), static_cast<float>(std::stof(args[3])), static_cast<float>(std::stof(args[4])),
+            static_cast<float>(std::stof(args[2])), args.size() > 5 ? std::stoi(args[5]) : -1);
+    }
+    if (args[0][0] == 'P') {
+        Color color = player::Player::getSeatColor(_players->size());
+
         _players->push_back(player::Player(color, std::stoi(args[1]), std::stoi(args[2]), std::stoi(args[3]),
             std::stoi(args[4]), std::stoi(args[5]), std::stoi(args[6]), std::stoi(args[7])));
+        // Saves older than the bots have no bot flag
+        _players->back().setIsBot(args.size() > 8 && std::stoi(args[8]) != 0);
     }
 }
 
 int indie::menu::GameScreen::countAlivePlayers()
 {
     int count = 0;
-    if (_player1_blue) {
-        if (this->_players->at(0).getIsAlive())
-            count++;
-    }
-    if (_player2_red) {
-        if (this->_players->at(1).getIsAlive())
-            count++;
-    }
-    if (_player3_green) {
-        if (this->_players->at(2).getIsAlive())
-            count++;
-    }
-    if (_player4_yellow) {
-        if (this->_players->at(3).getIsAlive())
+
+    for (auto &player : *this->_players)
+        if (player.getIsPlaying() && player.getIsAlive())
             count++;
-    }
     return count;
 }
 
 int indie::menu::GameScreen::getWinner()
 {
-    if (_player1_blue) {
-        if (this->_players->at(0).getIsAlive())
-            return 0;
-    }
-    if (_player2_red) {
-        if (this->_players->at(1).getIsAlive())
-            return 1;
-    }
-    if (_player3_green) {
-        if (this->_players->at(2).getIsAlive())
-            return 2;
-    }
-    if (_player4_yellow) {
-        if (this->_players->at(3).getIsAlive())
-            return 3;
-    }
+    for (size_t i = 0; i < this->_players->size(); i++)
+        if (this->_players->at(i).getIsPlaying() && this->_players->at(i).getIsAlive())
+            return (static_cast<int>(i));
     return 0;
 }
 
@@ -832,7 +925,246 @@ void indie::menu::GameScreen::endScreenDisplay()
     std::unique_ptr<ecs::entity::Entity> winner = std::make_unique<ecs::entity::Entity>(indie::ecs::entity::UNKNOWN);
     winner->addComponent<ecs::component::Transform>(
         tools::Tools::getPercentage(40.f, true), tools::Tools::getPercentage(35.f, false), 0.0f, 0.0f);
-    winner->addComponent<ecs::component::Drawable2D>(_playerAssets[getWinner()],
+    winner->addComponent<ecs::component::Drawable2D>(_playerAssets[getWinner() % 4],
         tools::Tools::getPercentage(30.f, false), tools::Tools::getPercentage(30.f, false), WHITE);
     addEntity(std::move(winner));
 }
+
+std::uint32_t indie::menu::GameScreen::getTick() const
+{
+    return (this->_tick);
+}
+
+namespace
+{
+    /// @brief Keyframe tile content, low bits
+    enum KeyframeTile : std::uint8_t { KF_EMPTY = 0, KF_WALL = 1, KF_BOX = 2 };
+
+    template <typename T> void putValue(std::vector<std::uint8_t> &out, T value)
+    {
+        const std::uint8_t *bytes = reinterpret_cast<const std::uint8_t *>(&value);
+        out.insert(out.end(), bytes, bytes + sizeof(T));
+    }
+
+    template <typename T> bool getValue(const std::vector<std::uint8_t> &in, size_t &cursor, T &value)
+    {
+        if (cursor + sizeof(T) > in.size())
+            return (false);
+        std::memcpy(&value, in.data() + cursor, sizeof(T));
+        cursor += sizeof(T);
+        return (true);
+    }
+
+    int tileIndex(float x, float y)
+    {
+        long col = std::lround((x + 20.0f) / 2.0f);
+        long row = std::lround((20.0f - y) / 2.0f);
+
+        if (col < 0 || col > 20 || row < 0 || row > 20)
+            return (-1);
+        return (static_cast<int>(row * 21 + col));
+    }
+} // namespace
+
+std::vector<std::uint8_t> indie::menu::GameScreen::captureKeyframe() const
+{
+    std::vector<std::uint8_t> keyframe;
+    std::uint8_t tiles[21 * 21] = {};
+    std::vector<indie::ecs::entity::Entity *> players;
+    std::vector<indie::ecs::entity::Entity *> bombs;
+
+    for (auto &entity : this->_entities) {
+        auto transformCompo = entity->getComponent<indie::ecs::component::Transform>(indie::ecs::component::TRANSFORM);
+        if (transformCompo == nullptr)
+            continue;
+        int tile = tileIndex(transformCompo->getX(), transformCompo->getY());
+        switch (entity->getEntityType()) {
+            case indie::ecs::entity::WALL:
+                if (tile >= 0)
+                    tiles[tile] |= KF_WALL;
+                break;
+            case indie::ecs::entity::BOXES:
+                if (tile >= 0)
+                    tiles[tile] |= KF_BOX;
+                break;
+            case indie::ecs::entity::BOMB: bombs.push_back(entity.get()); break;
+            case indie::ecs::entity::PLAYER: players.push_back(entity.get()); break;
+            default:
+                if (tile >= 0 && entity->hasCompoType(indie::ecs::component::COLLECTABLE))
+                    tiles[tile] |= static_cast<std::uint8_t>(
+                        (entity->getComponent<indie::ecs::component::Collectable>(indie::ecs::component::COLLECTABLE)
+                                ->getBonusType()
+                            + 1)
+                        << 2);
+                break;
+        }
+    }
+    putValue<std::uint8_t>(keyframe, static_cast<std::uint8_t>(this->_players->size()));
+    for (auto &player : *this->_players) {
+        putValue<std::uint8_t>(
+            keyframe, (player.getIsAlive() ? 1 : 0) | (player.getIsPlaying() ? 2 : 0) | (player.getIsBot() ? 4 : 0));
+        putValue<std::uint8_t>(keyframe, static_cast<std::uint8_t>(player.getBombRadius()));
+        putValue<std::uint8_t>(keyframe, static_cast<std::uint8_t>(player.getBombStock()));
+        putValue<std::uint8_t>(keyframe, static_cast<std::uint8_t>(player.getMaxBombStock()));
+        putValue<std::uint8_t>(keyframe, static_cast<std::uint8_t>(player.getSpeed()));
+    }
+    keyframe.insert(keyframe.end(), tiles, tiles + sizeof(tiles));
+    putValue<std::uint8_t>(keyframe, static_cast<std::uint8_t>(players.size()));
+    for (auto &entity : players) {
+        auto transformCompo = entity->getComponent<indie::ecs::component::Transform>(indie::ecs::component::TRANSFORM);
+        auto objectCompo = entity->getComponent<indie::ecs::component::Object>(indie::ecs::component::ANIMATED);
+        auto aliveCompo = entity->getComponent<indie::ecs::component::Alive>(indie::ecs::component::ALIVE);
+        auto controlCompo =
+            entity->getComponent<indie::ecs::component::PlayerControl>(indie::ecs::component::PLAYERCONTROL);
+        putValue<std::uint8_t>(keyframe, static_cast<std::uint8_t>(controlCompo->getPlayer()));
+        putValue<std::uint8_t>(keyframe, aliveCompo != nullptr && aliveCompo->getAlive());
+        putValue<float>(keyframe, transformCompo->getX());
+        putValue<float>(keyframe, transformCompo->getY());
+        putValue<float>(keyframe, objectCompo != nullptr ? objectCompo->getOrientation() : 0.0f);
+        putValue<std::int32_t>(keyframe, objectCompo != nullptr ? objectCompo->getAnimationsCounter() : 0);
+    }
+    putValue<std::uint16_t>(keyframe, static_cast<std::uint16_t>(bombs.size()));
+    for (auto &entity : bombs) {
+        auto transformCompo = entity->getComponent<indie::ecs::component::Transform>(indie::ecs::component::TRANSFORM);
+        auto explodableCompo =
+            entity->getComponent<indie::ecs::component::Explodable>(indie::ecs::component::EXPLODABLE);
+        putValue<std::uint8_t>(keyframe, static_cast<std::uint8_t>(explodableCompo->getPlayer()));
+        putValue<std::uint8_t>(keyframe, explodableCompo->getExplode() ? 1 : 0);
+        putValue<float>(keyframe, explodableCompo->getRange());
+        putValue<float>(keyframe, transformCompo->getX());
+        putValue<float>(keyframe, transformCompo->getY());
+        putValue<std::uint16_t>(keyframe, static_cast<std::uint16_t>(std::min<std::uint32_t>(
+            this->_explodeSystem->getRemainingTicks(explodableCompo), std::numeric_limits<std::uint16_t>::max())));
+    }
+    const indie::board::FlameField &flames = this->_explodeSystem->getFlameField();
+    putValue<std::uint16_t>(keyframe, static_cast<std::uint16_t>(flames.getBurning().count()));
+    flames.getBurning().forEach([&keyframe, &flames](int tile) {
+        putValue<std::uint16_t>(keyframe, static_cast<std::uint16_t>(tile));
+        putValue<std::uint8_t>(keyframe, flames.getLifetime(tile));
+    });
+    return (keyframe);
+}
+
+bool indie::menu::GameScreen::restoreKeyframe(const std::vector<std::uint8_t> &keyframe, std::uint32_t tick)
+{
+    size_t cursor = 0;
+    std::uint8_t count = 0;
+    std::uint16_t bombCount = 0;
+    std::uint16_t flameCount = 0;
+
+    if (!getValue(keyframe, cursor, count) || count != this->_players->size())
+        return (false);
+    for (auto &player : *this->_players) {
+        std::uint8_t stats[5];
+        for (auto &stat : stats)
+            if (!getValue(keyframe, cursor, stat))
+                return (false);
+        player.setIsAlive(stats[0] & 1);
+        player.setIsPlaying(stats[0] & 2);
+        player.setIsBot(stats[0] & 4);
+        player.setBombRadius(stats[1]);
+        player.setBombStock(stats[2]);
+        player.setMaxBombStock(stats[3]);
+        player.setSpeed(stats[4]);
+    }
+    if (cursor + 21 * 21 > keyframe.size())
+        return (false);
+    // Keep the floor, the first entity created by init
+    this->_inputSystem->unbindPlayers();
+    forgetBotPlans();
+    this->_explodeSystem->reset();
+    this->_entities.erase(this->_entities.begin() + 1, this->_entities.end());
+    for (int tile = 0; tile < 21 * 21; tile++, cursor++) {
+        float x = -20.0f + 2.0f * static_cast<float>(tile % 21);
+        float y = 20.0f - 2.0f * static_cast<float>(tile / 21);
+        std::uint8_t content = keyframe[cursor];
+        if (content & KF_WALL)
+            spawnWall(x, y);
+        if (content >> 2)
+            spawnBonus(static_cast<indie::ecs::component::bonusType>((content >> 2) - 1), x, y);
+        if (content & KF_BOX)
+            spawnBox(x, y);
+    }
+    if (!getValue(keyframe, cursor, count))
+        return (false);
+    for (std::uint8_t i = 0; i < count; i++) {
+        std::uint8_t player = 0;
+        std::uint8_t alive = 0;
+        float x = 0;
+        float y = 0;
+        float orientation = 0;
+        std::int32_t animation = 0;
+        if (!getValue(keyframe, cursor, player) || !getValue(keyframe, cursor, alive) || !getValue(keyframe, cursor, x)
+            || !getValue(keyframe, cursor, y) || !getValue(keyframe, cursor, orientation)
+            || !getValue(keyframe, cursor, animation) || player >= this->_players->size())
+            return (false);
+        spawnPlayer(player, x, y, alive);
+        auto objectCompo =
+            this->_entities.back()->getComponent<indie::ecs::component::Object>(indie::ecs::component::ANIMATED);
+        objectCompo->setOrientation(static_cast<indie::ecs::component::Object::ORIENTATION>(orientation));
+        objectCompo->setAnimationsCounter(animation);
+        raylib::Model::updateModelAnimation(objectCompo->getModel(), objectCompo->getAnimations()[0], animation);
+    }
+    if (!getValue(keyframe, cursor, bombCount))
+        return (false);
+    for (std::uint16_t i = 0; i < bombCount; i++) {
+        std::uint8_t player = 0;
+        std::uint8_t explode = 0;
+        float range = 0;
+        float x = 0;
+        float y = 0;
+        std::uint16_t fuse = 0;
+        if (!getValue(keyframe, cursor, player) || !getValue(keyframe, cursor, explode)
+            || !getValue(keyframe, cursor, range) || !getValue(keyframe, cursor, x) || !getValue(keyframe, cursor, y)
+            || !getValue(keyframe, cursor, fuse))
+            return (false);
+        spawnBomb(player, x, y, range, fuse);
+        if (explode) {
+            // Lit bombs explode at the next update, as they would have without the seek
+            this->_explodeSystem->disarm(this->_entities.back().get());
+            this->_entities.back()
+                ->getComponent<indie::ecs::component::Explodable>(indie::ecs::component::EXPLODABLE)
+                ->setExplode(true);
+            this->_explodeSystem->arm(this->_entities.back().get(), 0);
+        }
+    }
+    if (!getValue(keyframe, cursor, flameCount))
+        return (false);
+    for (std::uint16_t i = 0; i < flameCount; i++) {
+        std::uint16_t tile = 0;
+        std::uint8_t lifetime = 0;
+        if (!getValue(keyframe, cursor, tile) || !getValue(keyframe, cursor, lifetime))
+            return (false);
+        this->_explodeSystem->getFlameField().ignite(tile, lifetime);
+    }
+    this->_tick = tick;
+    this->_journal.beginTick(tick);
+    this->_is_game_finished = false;
+    this->_end_screen_display = true;
+    return (true);
+}
+
+void indie::menu::GameScreen::setMuted(bool muted)
+{
+    this->_muted = muted;
+}
+
+void indie::menu::GameScreen::setInputLatency(const indie::InputLatency *latency)
+{
+    this->_inputLatency = latency;
+}
+
+void indie::menu::GameScreen::setFrameStats(indie::profiling::FrameStats *stats)
+{
+    this->_frameStats = stats;
+}
+
+void indie::menu::GameScreen::setJobSystem(indie::core::JobSystem *jobs)
+{
+    this->_jobs = jobs;
+}
+
+void indie::menu::GameScreen::setMixer(indie::audio::AudioMixer *mixer)
+{
+    this->_mixer = mixer;
+}
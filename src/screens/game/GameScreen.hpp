@@ -12,25 +12,52 @@
 #ifndef GAMESCREEN_HPP_
 #define GAMESCREEN_HPP_
 
+#include <utility>
+#include <chrono>
+#include <cstdint>
 #include <fstream>
 #include <map>
 #include <memory>
 #include <sstream>
 #include <vector>
 
+#include "../../ai/Bot.hpp"
+#include "../../ai/SimState.hpp"
+#include "../../board/Board.hpp"
+#include "../../core/JobSystem.hpp"
 #include "../../ecs/entity/Entity.hpp"
 #include "../../ecs/system/ISystem.hpp"
 #include "../IScreen.hpp"
+#include "../../gameEvents/InputLatency.hpp"
+#include "../../profiling/FrameStats.hpp"
+#include "../../save/Journal.hpp"
 #include "../ecs/system/Collide/Collide.hpp"
 #include "../ecs/system/Draw2D/Draw2D.hpp"
 #include "../ecs/system/Draw3D/Draw3D.hpp"
 #include "../ecs/system/Explodable/Explodable.hpp"
+#include "../ecs/system/Input/Input.hpp"
 #include "../ecs/system/Movement/Movement.hpp"
 #include "../ecs/system/Object/Object.hpp"
+#include "../ecs/system/Scheduler/Scheduler.hpp"
 #include "../ecs/system/Sound/Sound.hpp"
 #include "events.hpp"
 #include "uiPlayerDisplay/UIPlayerDisplay.hpp"
 
+/// @brief Checkpoint written by the autosave
+#define AUTOSAVE_CHECKPOINT_PATH "Autosave.txt"
+/// @brief Journal of the deltas since the last autosave checkpoint
+#define AUTOSAVE_JOURNAL_PATH "Autosave.journal"
+/// @brief Fuse of the bombs dropped by the players, in seconds
+#define BOMB_FUSE_SECONDS 2
+/// @brief Sound of an exploding bomb
+#define BOMB_SOUND_PATH "assets/sound/bomb.ogg"
+/// @brief Ticks between two refreshes of the player panels
+#define HUD_PERIOD_TICKS 6
+/// @brief Ticks between two forced re-plans of a bot, each seat on its own phase
+#define BOT_REPLAN_PERIOD_TICKS 8
+/// @brief Ticks between two checks of the snapshot kernel against the systems
+#define SIM_CHECK_PERIOD_TICKS 60
+
 namespace indie
 {
     namespace menu
@@ -79,14 +106,6 @@ namespace indie
              */
             int handleEvent(indie::Event &event) override;
 
-            /**
-             * @brief Handle multiple input from multiple controllers / players
-             *
-             * @param event The event to handle
-             * @param index The controller number ( 0,1,2,3)
-             * @param type The type of entity (Player1, 2, 3 ,4)
-             */
-            void handleMultipleController(indie::Event &event, int index, indie::ecs::entity::entityType type);
             /**
              * @brief Add entity for the Game Screen
              *
@@ -112,20 +131,34 @@ namespace indie
              */
             indie::raylib::Camera3D getCamera() const;
             /**
-             * @brief Get the Players state (Playing or not)
+             * @brief Get the bitboard view of the arena, synchronized with the entities at the start of each tick
+             *
+             * @return const indie::board::Board& The board
+             */
+            const indie::board::Board &getBoard() const;
+            /**
+             * @brief Copy the state of the match into a snapshot a search bot can clone and step
+             *
+             * @return indie::ai::SimState The snapshot
+             */
+            indie::ai::SimState getSimState() const;
+            /**
+             * @brief Compare the match to the snapshot the kernel predicted for it, counting SIM_MISMATCHES
+             *
+             * Only what the systems decide is compared, walls and boxes, burning tiles and armed bombs, the players
+             * having moved before the snapshot was taken.
              *
-             * @param is_p1_playing is playing or not
-             * @param is_p2_playing is playing or not
-             * @param is_p3_playing is playing or not
-             * @param is_p4_playing is playing or not
+             * @param predicted Snapshot taken before the systems ran, stepped once with every stick at rest
+             * @return true If the kernel agrees with the systems
              */
-            void getPlayersPlaying(bool is_p1_playing, bool is_p2_playing, bool is_p3_playing, bool is_p4_playing);
+            bool checkSimState(const indie::ai::SimState &predicted) const;
             /**
              * @brief Init the map for the Game Screen
              *
              * @param map Vector of vector of char, to draw the map
+             * @param spawns Row and column of the spawn of each player, the players not playing are not spawned
              */
-            void initMap(std::vector<std::vector<char>> map);
+            void initMap(std::vector<std::vector<char>> map, const std::vector<std::pair<int, int>> &spawns);
             /**
              * @brief Init entities of the Game Screen
              *
@@ -145,15 +178,42 @@ namespace indie
             /**
              * @brief Save map entities into the save file
              *
+             * @param path Path of the save file
              */
-            void saveMapEntities();
+            void saveMapEntities(const std::string &path = "SaveFile.txt");
             /**
              * @brief Load the last saved file map
              *
+             * @param path Path of the save file
              * @return true If Map is loaded
              * @return false If map isn't loaded
              */
-            bool loadSavedMap();
+            bool loadSavedMap(const std::string &path = "SaveFile.txt");
+            /**
+             * @brief Start journaling the match and write a first checkpoint
+             *
+             * @param checkpointSeconds Seconds between two full checkpoints
+             */
+            void enableAutosave(size_t checkpointSeconds = 10);
+            /**
+             * @brief Stop journaling and discard the autosave files
+             *
+             */
+            void disableAutosave();
+            /**
+             * @brief Is there an autosave more recent than a save file?
+             *
+             * @param savePath Path of the save file
+             * @return true If the autosave should be preferred
+             */
+            bool hasNewerAutosave(const std::string &savePath = "SaveFile.txt") const;
+            /**
+             * @brief Restore the match from the last checkpoint and its journal
+             *
+             * @return true If the match is restored
+             * @return false If there is no checkpoint
+             */
+            bool recoverAutosave();
             /**
              * @brief Init the right entity from a string
              *
@@ -178,8 +238,167 @@ namespace indie
              *
              */
             void endScreenDisplay();
+            /**
+             * @brief Get the current simulation tick
+             *
+             * @return std::uint32_t Number of simulated ticks since the start of the match
+             */
+            std::uint32_t getTick() const;
+            /**
+             * @brief Serialize the simulated world into a compact keyframe
+             *
+             * @return std::vector<std::uint8_t> Keyframe bytes
+             */
+            std::vector<std::uint8_t> captureKeyframe() const;
+            /**
+             * @brief Rebuild the simulated world from a keyframe
+             *
+             * @param keyframe Keyframe bytes from captureKeyframe
+             * @param tick Tick the keyframe has been captured at
+             * @return true If the keyframe is valid
+             */
+            bool restoreKeyframe(const std::vector<std::uint8_t> &keyframe, std::uint32_t tick);
+            /**
+             * @brief Mute the game sounds, used while fast-forwarding
+             *
+             * @param muted Are the sounds muted?
+             */
+            void setMuted(bool muted);
+            /**
+             * @brief Set the latency statistics drawn over the game when visible
+             *
+             * @param latency Statistics owned by the game, nullptr for none
+             */
+            void setInputLatency(const indie::InputLatency *latency);
+            /**
+             * @brief Set the frame statistics fed by the systems and drawn over the game when visible
+             *
+             * @param stats Statistics owned by the game, nullptr for none
+             */
+            void setFrameStats(indie::profiling::FrameStats *stats);
+            /**
+             * @brief Set the job system the bots decide on
+             *
+             * @param jobs Job system owned by the game, nullptr to decide on the calling thread
+             */
+            void setJobSystem(indie::core::JobSystem *jobs);
+            /**
+             * @brief Set the mixer the sound system of the match posts to, before init
+             *
+             * @param mixer Mixer owned by the game, nullptr to play nothing
+             */
+            void setMixer(indie::audio::AudioMixer *mixer);
 
           private:
+            /**
+             * @brief Is the system only rendering?
+             *
+             * @param type Type of the system
+             * @return true If the system runs in draw instead of update
+             */
+            bool isRenderSystem(indie::ecs::system::SystemType type) const;
+            /**
+             * @brief Get the name of the trace zone of a system
+             *
+             * @param type Type of the system
+             * @return const char* Static name of the zone
+             */
+            static const char *getSystemZone(indie::ecs::system::SystemType type);
+            /**
+             * @brief Update a system, timing it for the trace and the frame statistics, from any thread
+             *
+             * @param system The system
+             */
+            void runSystem(indie::ecs::system::ISystem &system);
+            /**
+             * @brief Apply the end of tick rules (exploded bombs, bonuses, deaths)
+             *
+             */
+            void updateEntities();
+            /**
+             * @brief Let the bots choose the stick and button of their player, whatever the number of players
+             *
+             */
+            void driveBots();
+            /**
+             * @brief Place the bombs requested by the players this tick
+             *
+             */
+            void placeRequestedBombs();
+            /**
+             * @brief Play the explosion sound of every bomb exploding this tick
+             *
+             */
+            void playExplosionSound();
+            /**
+             * @brief Draw the flames left by the explosions, one translucent tile each
+             *
+             * @param camera Camera of the 3D scene
+             */
+            void drawFlames(indie::raylib::Camera3D &camera);
+            /**
+             * @brief Create a bomb entity
+             *
+             * @param player Owner of the bomb
+             * @param x X position of the bomb
+             * @param y Y position of the bomb
+             * @param range Explosion range
+             * @param fuseTicks Ticks before the explosion, -1 for the full fuse
+             */
+            void spawnBomb(int player, float x, float y, float range, int fuseTicks = -1);
+            /**
+             * @brief Create a wall entity
+             *
+             * @param x X position of the wall
+             * @param y Y position of the wall
+             */
+            void spawnWall(float x, float y);
+            /**
+             * @brief Create a destroyable box entity
+             *
+             * @param x X position of the box
+             * @param y Y position of the box
+             */
+            void spawnBox(float x, float y);
+            /**
+             * @brief Create a collectable bonus entity
+             *
+             * @param bonus Type of bonus
+             * @param x X position of the bonus
+             * @param y Y position of the bonus
+             */
+            void spawnBonus(indie::ecs::component::bonusType bonus, float x, float y);
+            /**
+             * @brief Create a player entity
+             *
+             * @param player Player index
+             * @param x X position of the player
+             * @param y Y position of the player
+             * @param alive Is the player alive?
+             */
+            void spawnPlayer(int player, float x, float y, bool alive = true);
+            /**
+             * @brief Write a full checkpoint and truncate the journal
+             *
+             */
+            void writeCheckpoint();
+            /**
+             * @brief Journal the players whose stats or position changed
+             *
+             */
+            void journalPlayers();
+            /**
+             * @brief Drop the plans of the bots, which were made on the world before a restore
+             *
+             */
+            void forgetBotPlans();
+            /**
+             * @brief Replay a journal record on the loaded checkpoint
+             *
+             * @param record The record
+             * @param lastTick Tick of the last record of the journal, the bombs keep what is left of their fuse then
+             */
+            void applyRecord(const indie::save::Journal::Record &record, std::uint32_t lastTick);
             /**
              * @brief Vector of players
              *
@@ -217,35 +436,90 @@ namespace indie
             indie::raylib::Camera3D _camera;
             std::map<int, std::string> _playerAssets;
             /**
-             * @brief Player1 is alive or not
+             * @brief Player4 is alive or not
              *
              */
-            bool _player1_blue;
+            bool _is_game_finished;
             /**
-             * @brief Player2 is alive or not
+             * @brief Is the end screen displayed?
              *
              */
-            bool _player2_red;
+            bool _end_screen_display;
             /**
-             * @brief Player3 is alive or not
+             * @brief Simulation tick counter
              *
              */
-            bool _player3_green;
+            std::uint32_t _tick;
             /**
-             * @brief Player4 is alive or not
+             * @brief Autosave journal
              *
              */
-            bool _player4_yellow;
+            indie::save::Journal _journal;
             /**
-             * @brief Player4 is alive or not
+             * @brief Last journaled state of each player
              *
              */
-            bool _is_game_finished;
+            std::vector<indie::save::Journal::Record> _journaledPlayers;
             /**
-             * @brief Is the end screen displayed?
+             * @brief Time between two autosave checkpoints
              *
              */
-            bool _end_screen_display;
+            std::chrono::seconds _checkpointInterval;
+            /**
+             * @brief Time of the last autosave checkpoint
+             *
+             */
+            std::chrono::steady_clock::time_point _lastCheckpoint;
+            /**
+             * @brief Are the game sounds muted?
+             *
+             */
+            bool _muted;
+            /**
+             * @brief Input latency readout
+             *
+             */
+            const indie::InputLatency *_inputLatency;
+            /**
+             * @brief Frame statistics overlay
+             *
+             */
+            indie::profiling::FrameStats *_frameStats;
+            /**
+             * @brief Job system of the game
+             *
+             */
+            indie::core::JobSystem *_jobs;
+            /**
+             * @brief Mixer of the game
+             *
+             */
+            indie::audio::AudioMixer *_mixer;
+            /**
+             * @brief Runs the update systems at their rates
+             *
+             */
+            indie::ecs::system::Scheduler _scheduler;
+            /**
+             * @brief Input system, holds the player entities handles
+             *
+             */
+            std::unique_ptr<indie::ecs::system::InputSystem> _inputSystem;
+            /**
+             * @brief Explodable system, owned by the systems vector, it holds the bomb fuses
+             *
+             */
+            indie::ecs::system::Explodable *_explodeSystem;
+            /**
+             * @brief Bitboard view of the arena
+             *
+             */
+            indie::board::Board _board;
+            /**
+             * @brief Bot of each player slot, used when the player is a bot
+             *
+             */
+            std::vector<indie::ai::Bot> _bots;
         };
     } // namespace menu
 } // namespace indie
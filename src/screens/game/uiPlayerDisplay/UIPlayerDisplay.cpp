@@ -16,6 +16,7 @@
 #include "Colors.hpp"
 #include "Vec2.hpp"
 
+#include <limits>
 #include <memory>
 #include <string>
 
@@ -33,6 +34,7 @@ namespace indie
                         std::make_unique<indie::ecs::system::Draw2DSystem>();
 
                     this->_player = player;
+                    this->_shown.fill(std::numeric_limits<short unsigned int>::max());
                     this->_systems.push_back(std::move(draw2DSystem));
                     this->_position = pos;
                     this->_size = size;
@@ -124,6 +126,14 @@ namespace indie
 
                 void UIPlayerDisplay::update()
                 {
+                    std::array<short unsigned int, 4> stats = {this->_player->getSpeed(),
+                        this->_player->getBombStock(), this->_player->getMaxBombStock(),
+                        this->_player->getBombRadius()};
+
+                    // The texts are rebuilt when a stat changes, not every frame
+                    if (stats == this->_shown)
+                        return;
+                    this->_shown = stats;
                     ecs::component::Drawable2D *speedText =
                         this->_mainEntity.at(3)->getComponent<ecs::component::Drawable2D>(ecs::component::DRAWABLE2D);
                     ecs::component::Drawable2D *stockText =
@@ -18,6 +18,7 @@
 #include "../../../player/Player.hpp"
 #include "Vec2.hpp"
 
+#include <array>
 #include <memory>
 #include <string>
 
@@ -120,6 +121,11 @@ namespace indie
                      * 
                      */
                     std::vector<std::unique_ptr<indie::ecs::system::ISystem>> _systems;
+                    /**
+                     * @brief Speed, bomb stock, max bomb stock and bomb range the texts show
+                     * 
+                     */
+                    std::array<short unsigned int, 4> _shown;
                 };
             } // namespace uiPlayerDisplay
         }     // namespace game
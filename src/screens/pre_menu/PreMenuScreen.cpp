@@ -354,7 +354,8 @@ void indie::menu::PreMenuScreen::handlePlayer3(indie::Event &event)
         //     _is_player3_ready = false;
         // }
     }
-    _players->at(2).setIsPlaying(_is_player3_ready);
+    if (_players->size() > 2)
+        _players->at(2).setIsPlaying(_is_player3_ready);
 }
 
 void indie::menu::PreMenuScreen::handlePlayer4(indie::Event &event)
@@ -402,5 +403,6 @@ void indie::menu::PreMenuScreen::handlePlayer4(indie::Event &event)
         //     _is_player4_ready = false;
         // }
     }
-    _players->at(3).setIsPlaying(_is_player4_ready);
+    if (_players->size() > 3)
+        _players->at(3).setIsPlaying(_is_player4_ready);
 }
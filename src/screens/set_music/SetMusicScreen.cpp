@@ -13,10 +13,10 @@
 #include "../../raylib/Raylib.hpp"
 #include "../../tools/Tools.hpp"
 
-indie::menu::SetMusicScreen::SetMusicScreen(std::map<int, indie::raylib::Sound> *musics)
+indie::menu::SetMusicScreen::SetMusicScreen(indie::audio::MusicPlayer *music)
     : _cursorPosition(MUSIC_100), _lastSeenCursorPos(5)
 {
-    _musics = musics;
+    _music = music;
 }
 
 void indie::menu::SetMusicScreen::init()
@@ -161,7 +161,7 @@ int indie::menu::SetMusicScreen::handleEvent(indie::Event &event)
         transformCompo->update(tools::Tools::getPercentage(38.f, true), checkCursorPosition(false), 0.0f, 0.0f);
     }
     if ((event.controller[0].code == indie::Event::ControllerCode::X_BUTTON) && _cursorPosition == MUSIC_0) {
-        _musics->begin()->second.setVolume(0);
+        _music->setVolume(0);
         if (_entities.size() == 15)
             _entities.erase(_entities.begin() + 14);
         std::unique_ptr<ecs::entity::Entity> valid0 = std::make_unique<ecs::entity::Entity>();
@@ -173,7 +173,7 @@ int indie::menu::SetMusicScreen::handleEvent(indie::Event &event)
         _lastSeenCursorPos = 1;
     }
     if ((event.controller[0].code == indie::Event::ControllerCode::X_BUTTON) && _cursorPosition == MUSIC_25) {
-        _musics->begin()->second.setVolume(0.25);
+        _music->setVolume(0.25);
         if (_entities.size() == 15)
             _entities.erase(_entities.begin() + 14);
         std::unique_ptr<ecs::entity::Entity> valid25 = std::make_unique<ecs::entity::Entity>();
@@ -185,7 +185,7 @@ int indie::menu::SetMusicScreen::handleEvent(indie::Event &event)
         _lastSeenCursorPos = 2;
     }
     if ((event.controller[0].code == indie::Event::ControllerCode::X_BUTTON) && _cursorPosition == MUSIC_50) {
-        _musics->begin()->second.setVolume(0.50);
+        _music->setVolume(0.50);
         if (_entities.size() == 15)
             _entities.erase(_entities.begin() + 14);
         std::unique_ptr<ecs::entity::Entity> valid50 = std::make_unique<ecs::entity::Entity>();
@@ -197,7 +197,7 @@ int indie::menu::SetMusicScreen::handleEvent(indie::Event &event)
         _lastSeenCursorPos = 3;
     }
     if ((event.controller[0].code == indie::Event::ControllerCode::X_BUTTON) && _cursorPosition == MUSIC_75) {
-        _musics->begin()->second.setVolume(0.75);
+        _music->setVolume(0.75);
         if (_entities.size() == 15)
             _entities.erase(_entities.begin() + 14);
         std::unique_ptr<ecs::entity::Entity> valid75 = std::make_unique<ecs::entity::Entity>();
@@ -209,7 +209,7 @@ int indie::menu::SetMusicScreen::handleEvent(indie::Event &event)
         _lastSeenCursorPos = 4;
     }
     if ((event.controller[0].code == indie::Event::ControllerCode::X_BUTTON) && _cursorPosition == MUSIC_100) {
-        _musics->begin()->second.setVolume(1);
+        _music->setVolume(1);
         if (_entities.size() == 15)
             _entities.erase(_entities.begin() + 14);
         std::unique_ptr<ecs::entity::Entity> valid100 = std::make_unique<ecs::entity::Entity>();
@@ -15,6 +15,7 @@
 #include <map>
 #include <vector>
 
+#include "../../audio/MusicPlayer.hpp"
 #include "../../ecs/entity/Entity.hpp"
 #include "../IScreen.hpp"
 #include "../ecs/system/Draw2D/Draw2D.hpp"
@@ -44,10 +45,10 @@ namespace indie
             /**
              * @brief Set the Music Screen object
              *
-             * @param musics Map for music on the screen
+             * @param music Music player of the Game
              *
              */
-            SetMusicScreen(std::map<int, indie::raylib::Sound> *musics);
+            SetMusicScreen(indie::audio::MusicPlayer *music);
             /**
              * @brief Destroy the Set Music Screen object
              *
@@ -97,10 +98,10 @@ namespace indie
 
           private:
             /**
-             * @brief Pointer of map of Sound from the Game
+             * @brief Pointer to the music player of the Game
              *
              */
-            std::map<int, indie::raylib::Sound> *_musics;
+            indie::audio::MusicPlayer *_music;
             /**
              * @brief Vector of entities for the Music Screen
              *
@@ -13,10 +13,10 @@
 #include "../../raylib/Raylib.hpp"
 #include "../../tools/Tools.hpp"
 
-indie::menu::SetSoundScreen::SetSoundScreen(std::vector<std::unique_ptr<indie::ecs::entity::Entity>> *sounds)
+indie::menu::SetSoundScreen::SetSoundScreen(indie::audio::AudioMixer *mixer)
     : _cursorPosition(SOUND_50), _lastSeenCursorPos(5)
 {
-    _sounds = sounds;
+    _mixer = mixer;
 }
 
 void indie::menu::SetSoundScreen::init()
@@ -226,12 +226,8 @@ int indie::menu::SetSoundScreen::handleEvent(indie::Event &event)
 
 void indie::menu::SetSoundScreen::setSounds(float volume)
 {
-    std::vector<std::unique_ptr<indie::ecs::entity::Entity>>::iterator _it_sounds = _sounds->begin();
-
-    while (_it_sounds != _sounds->end()) {
-        _it_sounds->get()->getComponent<ecs::component::Sound>(ecs::component::compoType::SOUND)->setVolume(volume);
-        ++_it_sounds;
-    }
+    _mixer->setCategoryVolume(indie::audio::SoundCategory::GAMEPLAY, volume);
+    _mixer->setCategoryVolume(indie::audio::SoundCategory::INTERFACE, volume);
 }
 
 void indie::menu::SetSoundScreen::update()
@@ -15,6 +15,7 @@
 #include <map>
 #include <vector>
 
+#include "../../audio/AudioMixer.hpp"
 #include "../../ecs/entity/Entity.hpp"
 #include "../IScreen.hpp"
 #include "../ecs/system/Draw2D/Draw2D.hpp"
@@ -44,9 +45,9 @@ namespace indie
             /**
              * @brief Set the Sound Screen object
              *
-             * @param sounds Vector of sounds entity for screen
+             * @param mixer Audio mixer of the Game
              */
-            SetSoundScreen(std::vector<std::unique_ptr<indie::ecs::entity::Entity>> *sounds);
+            SetSoundScreen(indie::audio::AudioMixer *mixer);
             /**
              * @brief Destroy the Set Sound Screen object
              *
@@ -107,10 +108,10 @@ namespace indie
 
           private:
             /**
-             * @brief Pointer to vector of entitites from the Game
+             * @brief Pointer to the audio mixer of the Game
              *
              */
-            std::vector<std::unique_ptr<indie::ecs::entity::Entity>> *_sounds;
+            indie::audio::AudioMixer *_mixer;
             /**
              * @brief Vector of entities for the Sound Screen
              *
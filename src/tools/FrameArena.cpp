@@ -0,0 +1,62 @@
+/*
+** EPITECH PROJECT, 2022
+** Bomberman
+** File description:
+** FrameArena
+*/
+
+#include "FrameArena.hpp"
+#include <cstdint>
+
+indie::tools::FrameArena::FrameArena(std::size_t capacity)
+    : _block(std::make_unique<std::byte[]>(capacity)), _capacity(capacity), _used(0), _overflow(), _overflowBytes(0)
+{
+}
+
+indie::tools::FrameArena::~FrameArena()
+{
+}
+
+void *indie::tools::FrameArena::allocate(std::size_t bytes, std::size_t alignment)
+{
+    std::uintptr_t base = reinterpret_cast<std::uintptr_t>(this->_block.get());
+    std::uintptr_t start = (base + this->_used + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+
+    if (start + bytes <= base + this->_capacity) {
+        this->_used = start + bytes - base;
+        return (reinterpret_cast<void *>(start));
+    }
+    // new[] of bytes is aligned for any fundamental type
+    this->_overflow.push_back(std::make_unique<std::byte[]>(bytes + alignment));
+    this->_overflowBytes += bytes + alignment;
+    std::uintptr_t overflow = reinterpret_cast<std::uintptr_t>(this->_overflow.back().get());
+    return (reinterpret_cast<void *>((overflow + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1)));
+}
+
+void indie::tools::FrameArena::reset()
+{
+    if (this->_overflowBytes > 0) {
+        this->_overflow.clear();
+        this->_capacity = (this->_capacity + this->_overflowBytes) * 2;
+        this->_block = std::make_unique<std::byte[]>(this->_capacity);
+        this->_overflowBytes = 0;
+    }
+    this->_used = 0;
+}
+
+std::size_t indie::tools::FrameArena::getUsed() const
+{
+    return (this->_used + this->_overflowBytes);
+}
+
+std::size_t indie::tools::FrameArena::getCapacity() const
+{
+    return (this->_capacity);
+}
+
+indie::tools::FrameArena &indie::tools::FrameArena::local()
+{
+    thread_local FrameArena arena;
+
+    return (arena);
+}
@@ -0,0 +1,165 @@
+/*
+** EPITECH PROJECT, 2022
+** Bomberman
+** File description:
+** FrameArena
+*/
+
+#ifndef FRAMEARENA_HPP_
+#define FRAMEARENA_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/// @brief Initial size of the arena of each thread, it grows to the peak of a frame when a frame overflows it
+#define FRAME_ARENA_SIZE (64 * 1024)
+
+namespace indie::tools
+{
+    /**
+     * @brief Bump pointer arena for the scratch data of a frame
+     *
+     * An allocation moves a pointer forward and a deallocation does nothing, everything is released at once by reset
+     * at the end of the tick and of the frame. A frame needing more than the block is served from the heap, then the
+     * next reset replaces the block with one covering that frame, so steady state gameplay never reaches the heap.
+     * Nothing allocated in the arena may outlive the frame.
+     */
+    class FrameArena {
+      public:
+        /**
+         * @brief Construct a new FrameArena object
+         *
+         * @param capacity Size of the block
+         */
+        explicit FrameArena(std::size_t capacity = FRAME_ARENA_SIZE);
+        /**
+         * @brief Destroy the FrameArena object
+         *
+         */
+        ~FrameArena();
+        FrameArena(const FrameArena &) = delete;
+        FrameArena &operator=(const FrameArena &) = delete;
+
+        /**
+         * @brief Allocate memory valid until the next reset
+         *
+         * @param bytes Size of the allocation
+         * @param alignment Alignment of the allocation, a power of two
+         * @return void* The memory
+         */
+        void *allocate(std::size_t bytes, std::size_t alignment);
+        /**
+         * @brief Release every allocation, growing the block when the frame overflowed it
+         *
+         */
+        void reset();
+        /**
+         * @brief Get the bytes allocated since the last reset
+         *
+         * @return std::size_t Allocated bytes, overflow included
+         */
+        std::size_t getUsed() const;
+        /**
+         * @brief Get the size of the block
+         *
+         * @return std::size_t Size of the block
+         */
+        std::size_t getCapacity() const;
+        /**
+         * @brief Get the arena of the calling thread
+         *
+         * @return FrameArena& The arena
+         */
+        static FrameArena &local();
+
+      private:
+        /// @brief The block
+        std::unique_ptr<std::byte[]> _block;
+        /// @brief Size of the block
+        std::size_t _capacity;
+        /// @brief Bytes used in the block
+        std::size_t _used;
+        /// @brief Allocations that did not fit in the block
+        std::vector<std::unique_ptr<std::byte[]>> _overflow;
+        /// @brief Bytes allocated on the heap since the last reset
+        std::size_t _overflowBytes;
+    };
+
+    /**
+     * @brief STL allocator drawing from a frame arena
+     *
+     * @tparam T Allocated type
+     */
+    template <typename T> class FrameAllocator {
+      public:
+        using value_type = T;
+
+        /**
+         * @brief Construct a new FrameAllocator object on the arena of the calling thread
+         *
+         */
+        FrameAllocator() noexcept : _arena(&FrameArena::local())
+        {
+        }
+        /**
+         * @brief Construct a new FrameAllocator object on an arena
+         *
+         * @param arena The arena
+         */
+        explicit FrameAllocator(FrameArena &arena) noexcept : _arena(&arena)
+        {
+        }
+        /**
+         * @brief Rebind an allocator of another type
+         *
+         * @param other The allocator
+         */
+        template <typename U> FrameAllocator(const FrameAllocator<U> &other) noexcept : _arena(other.getArena())
+        {
+        }
+        /**
+         * @brief Allocate elements in the arena
+         *
+         * @param count Number of elements
+         * @return T* The elements
+         */
+        T *allocate(std::size_t count)
+        {
+            return (static_cast<T *>(this->_arena->allocate(count * sizeof(T), alignof(T))));
+        }
+        /**
+         * @brief Does nothing, the arena is released at the end of the frame
+         *
+         */
+        void deallocate(T *, std::size_t) noexcept
+        {
+        }
+        /**
+         * @brief Get the arena of the allocator
+         *
+         * @return FrameArena* The arena
+         */
+        FrameArena *getArena() const noexcept
+        {
+            return (this->_arena);
+        }
+        template <typename U> bool operator==(const FrameAllocator<U> &other) const noexcept
+        {
+            return (this->_arena == other.getArena());
+        }
+        template <typename U> bool operator!=(const FrameAllocator<U> &other) const noexcept
+        {
+            return (this->_arena != other.getArena());
+        }
+
+      private:
+        /// @brief The arena
+        FrameArena *_arena;
+    };
+
+    /// @brief Vector living until the end of the frame
+    template <typename T> using FrameVector = std::vector<T, FrameAllocator<T>>;
+} // namespace indie::tools
+
+#endif /* !FRAMEARENA_HPP_ */
@@ -0,0 +1,129 @@
+/*
+** EPITECH PROJECT, 2022
+** Bomberman
+** File description:
+** SpscRing
+*/
+
+#ifndef SPSCRING_HPP_
+#define SPSCRING_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace indie::tools
+{
+    /**
+     * @brief Bounded lock-free queue for exactly one producer and one consumer
+     *
+     * The producer only writes the head and the consumer only writes the tail, each with release ordering, so a
+     * push or a pop is a couple of relaxed loads and one store: no lock, no allocation, no system call.
+     *
+     * @tparam T Element type, copied in and out
+     * @tparam Capacity Number of slots, must be a power of two
+     */
+    template <typename T, std::size_t Capacity> class SpscRing {
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "SpscRing capacity must be a power of two");
+
+      public:
+        /**
+         * @brief Construct a new empty SpscRing object
+         *
+         */
+        SpscRing() : _head(0), _tail(0)
+        {
+        }
+        /**
+         * @brief Destroy the SpscRing object
+         *
+         */
+        ~SpscRing() = default;
+        SpscRing(const SpscRing &) = delete;
+        SpscRing &operator=(const SpscRing &) = delete;
+
+        /**
+         * @brief Push an element (producer side)
+         *
+         * @param value Element to push
+         * @return true If pushed
+         * @return false If the queue is full
+         */
+        bool push(const T &value)
+        {
+            std::size_t head = _head.load(std::memory_order_relaxed);
+
+            if (head - _tail.load(std::memory_order_acquire) == Capacity)
+                return (false);
+            _slots[head & (Capacity - 1)] = value;
+            _head.store(head + 1, std::memory_order_release);
+            return (true);
+        }
+        /**
+         * @brief Look at the oldest element without removing it (consumer side)
+         *
+         * @return const T* The element, nullptr if the queue is empty
+         */
+        const T *front() const
+        {
+            std::size_t tail = _tail.load(std::memory_order_relaxed);
+
+            if (tail == _head.load(std::memory_order_acquire))
+                return (nullptr);
+            return (&_slots[tail & (Capacity - 1)]);
+        }
+        /**
+         * @brief Remove the oldest element (consumer side), front must not be nullptr
+         *
+         */
+        void popFront()
+        {
+            _tail.store(_tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+        /**
+         * @brief Pop an element (consumer side)
+         *
+         * @param value Filled with the oldest element
+         * @return true If an element has been popped
+         * @return false If the queue is empty
+         */
+        bool pop(T &value)
+        {
+            const T *element = front();
+
+            if (element == nullptr)
+                return (false);
+            value = *element;
+            popFront();
+            return (true);
+        }
+        /**
+         * @brief Is the queue empty? Only exact from the consumer thread
+         *
+         * @return true If empty
+         */
+        bool empty() const
+        {
+            return (_tail.load(std::memory_order_relaxed) == _head.load(std::memory_order_acquire));
+        }
+
+      private:
+        /**
+         * @brief Next slot written by the producer
+         *
+         */
+        alignas(64) std::atomic<std::size_t> _head;
+        /**
+         * @brief Next slot read by the consumer
+         *
+         */
+        alignas(64) std::atomic<std::size_t> _tail;
+        /**
+         * @brief Storage
+         *
+         */
+        alignas(64) std::array<T, Capacity> _slots;
+    };
+} // namespace indie::tools
+
+#endif /* !SPSCRING_HPP_ */
@@ -0,0 +1,167 @@
+/*
+** EPITECH PROJECT, 2022
+** Bomberman
+** File description:
+** TimerWheel
+*/
+
+#ifndef TIMERWHEEL_HPP_
+#define TIMERWHEEL_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace indie::tools
+{
+    /**
+     * @brief Hierarchical timer wheel driven by an integer tick clock
+     *
+     * Level 0 has one slot per tick for the next 64 ticks, each upper level has slots 64 times wider. A timer is only
+     * touched when it is scheduled, when its upper level slot is reached (at most once per level) and when it fires,
+     * so advancing the clock costs nothing for the timers that are not due.
+     *
+     * @tparam T Value given back when the timer fires
+     */
+    template <typename T> class TimerWheel {
+      public:
+        /// @brief Longest delay, in ticks, longer delays are shortened to it
+        static constexpr std::uint64_t MAX_DELAY = (std::uint64_t(1) << (6 * 4)) - 1;
+
+        /**
+         * @brief Construct a new TimerWheel object at tick 0
+         *
+         */
+        TimerWheel() : _now(0), _size(0)
+        {
+        }
+        /**
+         * @brief Current tick
+         *
+         * @return std::uint64_t Number of advances since construction
+         */
+        std::uint64_t now() const
+        {
+            return (_now);
+        }
+        /**
+         * @brief Number of pending timers
+         *
+         * @return std::size_t Pending timers
+         */
+        std::size_t size() const
+        {
+            return (_size);
+        }
+        /**
+         * @brief Schedule a timer
+         *
+         * @param deadline Tick the timer fires at, timers in the past fire at the next advance
+         * @param value Value given back when the timer fires
+         */
+        void schedule(std::uint64_t deadline, const T &value)
+        {
+            if (deadline <= _now)
+                deadline = _now + 1;
+            if (deadline - _now > MAX_DELAY)
+                deadline = _now + MAX_DELAY;
+            insert({deadline, value});
+            _size++;
+        }
+        /**
+         * @brief Move the clock one tick forward and fire the timers due
+         *
+         * @param fire Called with the value of each timer due, it may schedule new timers
+         */
+        template <typename F> void advance(F &&fire)
+        {
+            _now++;
+            // Higher levels first, so a timer cascading through several levels lands in level 0 in the same advance
+            for (std::size_t level = LEVELS - 1; level > 0; level--) {
+                if ((_now & ((std::uint64_t(1) << (BITS * level)) - 1)) != 0)
+                    continue;
+                _scratch.swap(_slots[level][(_now >> (BITS * level)) & MASK]);
+                for (auto &entry : _scratch)
+                    insert(entry);
+                _scratch.clear();
+            }
+            _scratch.swap(_slots[0][_now & MASK]);
+            _size -= _scratch.size();
+            for (auto &entry : _scratch)
+                fire(entry.value);
+            _scratch.clear();
+        }
+        /**
+         * @brief Drop every pending timer, the clock keeps its tick
+         *
+         */
+        void clear()
+        {
+            for (auto &level : _slots)
+                for (auto &slot : level)
+                    slot.clear();
+            _size = 0;
+        }
+
+      private:
+        /// @brief Bits of the tick handled by each level
+        static constexpr std::size_t BITS = 6;
+        /// @brief Number of levels
+        static constexpr std::size_t LEVELS = 4;
+        /// @brief Slots per level
+        static constexpr std::size_t SLOTS = std::size_t(1) << BITS;
+        /// @brief Mask of the slot index
+        static constexpr std::uint64_t MASK = SLOTS - 1;
+
+        /**
+         * @brief A pending timer
+         *
+         */
+        struct Entry {
+            /// @brief Tick the timer fires at
+            std::uint64_t deadline;
+            /// @brief Value given back when the timer fires
+            T value;
+        };
+
+        /**
+         * @brief Put a timer in the slot matching its distance to the current tick
+         *
+         * @param entry The timer, its deadline is not in the past
+         */
+        void insert(const Entry &entry)
+        {
+            std::uint64_t delay = entry.deadline - _now;
+            std::size_t level = 0;
+
+            while (level < LEVELS - 1 && delay >= (std::uint64_t(1) << (BITS * (level + 1))))
+                level++;
+            _slots[level][(entry.deadline >> (BITS * level)) & MASK].push_back(entry);
+        }
+
+        /**
+         * @brief Current tick
+         *
+         */
+        std::uint64_t _now;
+        /**
+         * @brief Number of pending timers
+         *
+         */
+        std::size_t _size;
+        /**
+         * @brief Timers of each slot of each level, the vectors keep their capacity between uses
+         *
+         */
+        std::array<std::array<std::vector<Entry>, SLOTS>, LEVELS> _slots;
+        /**
+         * @brief Slot being cascaded or fired
+         *
+         */
+        std::vector<Entry> _scratch;
+    };
+} // namespace indie::tools
+
+#endif /* !TIMERWHEEL_HPP_ */
@@ -0,0 +1,125 @@
+/**
+ * @file SchedulerTests.cpp
+ * @brief Checks that the scheduler runs the systems of a tick concurrently when their accesses allow it
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "../src/core/JobSystem.hpp"
+#include "../src/ecs/system/Collide/Collide.hpp"
+#include "../src/ecs/system/Explodable/Explodable.hpp"
+#include "../src/ecs/system/Movement/Movement.hpp"
+#include "../src/ecs/system/Scheduler/Scheduler.hpp"
+#include "../src/ecs/system/Sound/Sound.hpp"
+
+namespace
+{
+    /// @brief Longest wait for a system expected to run alongside another
+    constexpr std::chrono::seconds TIMEOUT(2);
+
+    /**
+     * @brief Report a failed check
+     *
+     * @param ok Result of the check
+     * @param what What was checked
+     * @return int 0 if it holds, 1 otherwise
+     */
+    int check(bool ok, const char *what)
+    {
+        if (!ok)
+            std::cerr << "FAILED: " << what << std::endl;
+        return (ok ? 0 : 1);
+    }
+
+    /**
+     * @brief Check which systems of the tick may overlap, from their accesses alone
+     *
+     * @return int Number of failed checks
+     */
+    int testConflicts()
+    {
+        using indie::ecs::system::Scheduler;
+        indie::ecs::system::MovementSystem movement;
+        indie::ecs::system::Collide collide;
+        indie::ecs::system::Explodable explodable;
+        indie::ecs::system::Sound sound;
+        int failures = 0;
+
+        failures += check(!movement.getAccess().structural && !collide.getAccess().structural
+                && !explodable.getAccess().structural,
+            "the tick systems defer their removals");
+        failures += check(!Scheduler::conflicts(movement.getAccess(), sound.getAccess()), "movement and sound overlap");
+        failures += check(!Scheduler::conflicts(collide.getAccess(), sound.getAccess()), "collisions and sound overlap");
+        failures +=
+            check(!Scheduler::conflicts(explodable.getAccess(), sound.getAccess()), "explosions and sound overlap");
+        failures +=
+            check(Scheduler::conflicts(movement.getAccess(), collide.getAccess()), "collisions wait for the movement");
+        failures += check(
+            Scheduler::conflicts(collide.getAccess(), explodable.getAccess()), "explosions wait for the collisions");
+        return (failures);
+    }
+
+    /**
+     * @brief Run a tick and check that the movement and the sound are in the same wave
+     *
+     * The movement only returns once the sound started, which never happens if the sound waits for it.
+     *
+     * @return int Number of failed checks
+     */
+    int testSameWave()
+    {
+        indie::core::JobSystem jobs(2);
+        indie::ecs::system::Scheduler scheduler;
+        indie::ecs::system::MovementSystem movement;
+        indie::ecs::system::Collide collide;
+        indie::ecs::system::Explodable explodable;
+        indie::ecs::system::Sound sound;
+        std::vector<indie::ecs::system::ISystem *> systems = {&movement, &sound, &collide, &explodable};
+        std::atomic<bool> soundStarted(false);
+        std::atomic<bool> overlapped(false);
+        std::atomic<bool> movementDone(false);
+        std::atomic<bool> collideAfterMovement(false);
+        std::atomic<bool> soundOnMain(false);
+        int failures = 0;
+
+        scheduler.run(systems, 0, &jobs, [&](indie::ecs::system::ISystem &system) {
+            switch (system.getSystemType()) {
+                case indie::ecs::system::MOVEMENTSYSTEM: {
+                    auto deadline = std::chrono::steady_clock::now() + TIMEOUT;
+                    while (!soundStarted && std::chrono::steady_clock::now() < deadline)
+                        std::this_thread::yield();
+                    overlapped = soundStarted.load();
+                    movementDone = true;
+                    break;
+                }
+                case indie::ecs::system::SOUNDSYSTEM:
+                    soundOnMain = jobs.isMainThread();
+                    soundStarted = true;
+                    break;
+                case indie::ecs::system::COLLIDESYSTEM: collideAfterMovement = movementDone.load(); break;
+                default: break;
+            }
+        });
+        failures += check(overlapped, "movement and sound run in the same wave");
+        failures += check(soundOnMain, "sound runs on the main thread");
+        failures += check(collideAfterMovement, "collisions run after the movement");
+        return (failures);
+    }
+} // namespace
+
+int main()
+{
+    int failures = testConflicts() + testSameWave();
+
+    if (failures == 0)
+        std::cout << "Scheduler tests passed" << std::endl;
+    return (failures == 0 ? 0 : 1);
+}